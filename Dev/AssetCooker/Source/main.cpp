@@ -7,10 +7,15 @@
 #include <thread>
 #include <chrono>
 #include <fstream>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <functional>
 #include <iomanip> // For std::quoted
 #include <nlohmann/json.hpp>
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp> // Added for make_mat4
+#include <glm/gtc/quaternion.hpp>
 
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
@@ -46,12 +51,30 @@ struct OakTexHeader {
     uint32_t format = 0; // 0 = RGBA8
 };
 
+// Local-space box, and a sphere around the box's center
+struct OakMeshBounds {
+    glm::vec3 min = glm::vec3(0.0f);
+    glm::vec3 max = glm::vec3(0.0f);
+    glm::vec3 center = glm::vec3(0.0f);
+    float radius = 0.0f;
+};
+
+// One source mesh: a range of the index buffer
+struct OakMeshSubmesh {
+    uint32_t indexOffset = 0;
+    uint32_t indexCount = 0;
+    OakMeshBounds bounds;
+};
+
 struct OakMeshHeader {
     char signature[4] = {'O', 'A', 'K', 'M'};
+    uint32_t version = 2;
     uint32_t vertexCount = 0;
     uint32_t indexCount = 0;
     uint32_t boneCount = 0;        // Number of USED bones (compact count)
     uint32_t jointRemapCount = 0;  // Same as boneCount - for joint_remaps array
+    uint32_t submeshCount = 0;
+    OakMeshBounds bounds;          // All submeshes
 };
 
 struct Vertex {
@@ -658,6 +681,178 @@ bool CookTexture(const fs::path& input, const fs::path& output) {
     }
 }
 
+// Bounds of the points a callback produces: the box first, then the sphere radius around its center
+template<typename ForEachPoint>
+OakMeshBounds ComputeBounds(ForEachPoint forEachPoint) {
+    OakMeshBounds bounds;
+    bool any = false;
+    forEachPoint([&](const glm::vec3& p) {
+        bounds.min = any ? glm::min(bounds.min, p) : p;
+        bounds.max = any ? glm::max(bounds.max, p) : p;
+        any = true;
+    });
+    if (!any) return bounds;
+
+    bounds.center = (bounds.min + bounds.max) * 0.5f;
+    float radiusSq = 0.0f;
+    forEachPoint([&](const glm::vec3& p) {
+        glm::vec3 d = p - bounds.center;
+        radiusSq = std::max(radiusSq, glm::dot(d, d));
+    });
+    bounds.radius = std::sqrt(radiusSq);
+    return bounds;
+}
+
+// Union of boxes; the sphere is centred on the union box and encloses every input sphere
+OakMeshBounds MergeBounds(const std::vector<OakMeshSubmesh>& submeshes) {
+    OakMeshBounds merged;
+    if (submeshes.empty()) return merged;
+
+    merged.min = submeshes[0].bounds.min;
+    merged.max = submeshes[0].bounds.max;
+    for (const OakMeshSubmesh& submesh : submeshes) {
+        merged.min = glm::min(merged.min, submesh.bounds.min);
+        merged.max = glm::max(merged.max, submesh.bounds.max);
+    }
+    merged.center = (merged.min + merged.max) * 0.5f;
+    for (const OakMeshSubmesh& submesh : submeshes) {
+        merged.radius = std::max(merged.radius, glm::length(submesh.bounds.center - merged.center) + submesh.bounds.radius);
+    }
+    return merged;
+}
+
+glm::vec3 SampleVectorKeys(const aiVectorKey* keys, unsigned int count, double time, const glm::vec3& fallback) {
+    if (count == 0) return fallback;
+    if (count == 1 || time <= keys[0].mTime) return glm::vec3(keys[0].mValue.x, keys[0].mValue.y, keys[0].mValue.z);
+    for (unsigned int k = 1; k < count; ++k) {
+        if (time <= keys[k].mTime) {
+            double span = keys[k].mTime - keys[k - 1].mTime;
+            float f = span > 0.0 ? static_cast<float>((time - keys[k - 1].mTime) / span) : 0.0f;
+            glm::vec3 a(keys[k - 1].mValue.x, keys[k - 1].mValue.y, keys[k - 1].mValue.z);
+            glm::vec3 b(keys[k].mValue.x, keys[k].mValue.y, keys[k].mValue.z);
+            return glm::mix(a, b, f);
+        }
+    }
+    const aiVector3D& last = keys[count - 1].mValue;
+    return glm::vec3(last.x, last.y, last.z);
+}
+
+glm::quat SampleQuatKeys(const aiQuatKey* keys, unsigned int count, double time, const glm::quat& fallback) {
+    auto toGlm = [](const aiQuaternion& q) { return glm::quat(q.w, q.x, q.y, q.z); };
+    if (count == 0) return fallback;
+    if (count == 1 || time <= keys[0].mTime) return toGlm(keys[0].mValue);
+    for (unsigned int k = 1; k < count; ++k) {
+        if (time <= keys[k].mTime) {
+            double span = keys[k].mTime - keys[k - 1].mTime;
+            float f = span > 0.0 ? static_cast<float>((time - keys[k - 1].mTime) / span) : 0.0f;
+            return glm::slerp(toGlm(keys[k - 1].mValue), toGlm(keys[k].mValue), f);
+        }
+    }
+    return toGlm(keys[count - 1].mValue);
+}
+
+// Model matrices of the compact joints: the bind pose, then frames sampled at 30 Hz from every
+// animation in the source file. Translations are scaled like the cooked IBMs.
+std::vector<std::vector<glm::mat4>> SampleJointPoses(const aiScene* scene, const std::vector<std::string>& jointNames,
+                                                     const std::vector<glm::mat4>& compactIBMs, float scale) {
+    std::vector<std::vector<glm::mat4>> poses;
+
+    std::vector<glm::mat4> bindPose(compactIBMs.size());
+    for (size_t j = 0; j < compactIBMs.size(); ++j) {
+        bindPose[j] = glm::inverse(compactIBMs[j]);
+    }
+    poses.push_back(bindPose);
+
+    std::unordered_map<std::string, size_t> compactIndex;
+    for (size_t j = 0; j < jointNames.size(); ++j) {
+        compactIndex[jointNames[j]] = j;
+    }
+
+    for (unsigned int a = 0; a < scene->mNumAnimations; ++a) {
+        const aiAnimation* anim = scene->mAnimations[a];
+        double ticksPerSecond = anim->mTicksPerSecond > 0.0 ? anim->mTicksPerSecond : 25.0;
+        int frames = std::clamp(static_cast<int>(std::ceil(anim->mDuration / ticksPerSecond * 30.0)), 1, 600);
+
+        std::unordered_map<std::string, const aiNodeAnim*> channels;
+        for (unsigned int c = 0; c < anim->mNumChannels; ++c) {
+            channels[anim->mChannels[c]->mNodeName.C_Str()] = anim->mChannels[c];
+        }
+
+        for (int frame = 0; frame <= frames; ++frame) {
+            double time = anim->mDuration * frame / frames;
+            std::vector<glm::mat4> pose = bindPose;
+
+            std::function<void(const aiNode*, const glm::mat4&)> walk = [&](const aiNode* node, const glm::mat4& parent) {
+                const aiMatrix4x4& m = node->mTransformation;
+                glm::mat4 local = glm::transpose(glm::make_mat4(&m.a1));
+
+                auto channel = channels.find(node->mName.C_Str());
+                if (channel != channels.end()) {
+                    aiVector3D nodeScaling, nodePosition;
+                    aiQuaternion nodeRotation;
+                    m.Decompose(nodeScaling, nodeRotation, nodePosition);
+                    const aiNodeAnim* c = channel->second;
+                    glm::vec3 t = SampleVectorKeys(c->mPositionKeys, c->mNumPositionKeys, time, glm::vec3(nodePosition.x, nodePosition.y, nodePosition.z));
+                    glm::quat r = SampleQuatKeys(c->mRotationKeys, c->mNumRotationKeys, time, glm::quat(nodeRotation.w, nodeRotation.x, nodeRotation.y, nodeRotation.z));
+                    glm::vec3 s = SampleVectorKeys(c->mScalingKeys, c->mNumScalingKeys, time, glm::vec3(nodeScaling.x, nodeScaling.y, nodeScaling.z));
+                    local = glm::mat4_cast(glm::normalize(r));
+                    local[0] *= s.x;
+                    local[1] *= s.y;
+                    local[2] *= s.z;
+                    local[3] = glm::vec4(t, 1.0f);
+                }
+
+                glm::mat4 global = parent * local;
+                auto joint = compactIndex.find(node->mName.C_Str());
+                if (joint != compactIndex.end()) {
+                    glm::mat4 scaled = global;
+                    scaled[3] = glm::vec4(glm::vec3(global[3]) * scale, 1.0f);
+                    pose[joint->second] = scaled;
+                }
+                for (unsigned int i = 0; i < node->mNumChildren; ++i) {
+                    walk(node->mChildren[i], global);
+                }
+            };
+            walk(scene->mRootNode, glm::mat4(1.0f));
+            poses.push_back(std::move(pose));
+        }
+    }
+    return poses;
+}
+
+// Bounds of skinned vertices over every pose: each joint's vertices are boxed in that joint's bind space,
+// and the box corners are carried through the joint's model matrix in each pose
+OakMeshBounds ComputeSkinnedBounds(const Vertex* vertices, uint32_t count, const std::vector<glm::mat4>& compactIBMs,
+                                   const std::vector<std::vector<glm::mat4>>& poses) {
+    size_t jointCount = compactIBMs.size();
+    std::vector<glm::vec3> boxMin(jointCount, glm::vec3(FLT_MAX));
+    std::vector<glm::vec3> boxMax(jointCount, glm::vec3(-FLT_MAX));
+    for (uint32_t v = 0; v < count; ++v) {
+        for (int slot = 0; slot < 4; ++slot) {
+            if (vertices[v].weights[slot] <= 0.0f) continue;
+            size_t joint = static_cast<size_t>(vertices[v].joints[slot]);
+            if (joint >= jointCount) continue;
+            glm::vec3 p = glm::vec3(compactIBMs[joint] * glm::vec4(vertices[v].position, 1.0f));
+            boxMin[joint] = glm::min(boxMin[joint], p);
+            boxMax[joint] = glm::max(boxMax[joint], p);
+        }
+    }
+
+    return ComputeBounds([&](auto&& emit) {
+        for (const std::vector<glm::mat4>& pose : poses) {
+            for (size_t joint = 0; joint < jointCount; ++joint) {
+                if (boxMin[joint].x > boxMax[joint].x) continue; // No vertices on this joint
+                for (int corner = 0; corner < 8; ++corner) {
+                    glm::vec3 p((corner & 1) ? boxMax[joint].x : boxMin[joint].x,
+                                (corner & 2) ? boxMax[joint].y : boxMin[joint].y,
+                                (corner & 4) ? boxMax[joint].z : boxMin[joint].z);
+                    emit(glm::vec3(pose[joint] * glm::vec4(p, 1.0f)));
+                }
+            }
+        }
+    });
+}
+
 bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f) {
     std::cout << "[Cooker] Processing Mesh (COMPACT JOINTS): " << input << " -> " << output;
     if (scale != 1.0f) {
@@ -761,6 +956,15 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
     std::vector<Vertex> vertices;
     std::vector<uint32_t> indices;
     uint32_t indexOffset = 0;
+
+    struct SourceMesh {
+        uint32_t firstVertex;
+        uint32_t vertexCount;
+        uint32_t firstIndex;
+        uint32_t indexCount;
+        bool isSkinned;
+    };
+    std::vector<SourceMesh> sourceMeshes;
     
     std::function<void(const aiNode*, const glm::mat4&)> processMeshes = [&](const aiNode* node, const glm::mat4& parentTransform) {
         aiMatrix4x4 m = node->mTransformation;
@@ -854,6 +1058,7 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
             }
             
             // Add indices
+            uint32_t meshFirstIndex = static_cast<uint32_t>(indices.size());
             for (unsigned int f = 0; f < mesh->mNumFaces; f++) {
                 aiFace& face = mesh->mFaces[f];
                 for (unsigned int j = 0; j < face.mNumIndices; j++) {
@@ -861,6 +1066,9 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
                 }
             }
             indexOffset += mesh->mNumVertices;
+
+            sourceMeshes.push_back({ meshVertexOffset, mesh->mNumVertices, meshFirstIndex,
+                static_cast<uint32_t>(indices.size()) - meshFirstIndex, isSkinned });
         }
         
         for (unsigned int i = 0; i < node->mNumChildren; i++) {
@@ -869,9 +1077,44 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
     };
     processMeshes(scene->mRootNode, glm::mat4(1.0f));
 
+    // ============================================
+    // Bounds per source mesh. Skinned ones cover every pose the skeleton takes in this file's
+    // animations; clips cooked from other files aren't known here, so when there are none the box
+    // is grown to the cube around the bind-pose sphere (any rotation of the pose about its centre).
+    // ============================================
+    std::vector<std::vector<glm::mat4>> jointPoses;
+    if (!compactIBMs.empty()) {
+        std::vector<std::string> jointNames;
+        for (uint16_t skelIdx : joint_remaps) {
+            jointNames.push_back(skeleton->joint_names()[skelIdx]);
+        }
+        jointPoses = SampleJointPoses(scene, jointNames, compactIBMs, scale);
+    }
+
+    std::vector<OakMeshSubmesh> submeshes;
+    for (const SourceMesh& source : sourceMeshes) {
+        OakMeshSubmesh submesh;
+        submesh.indexOffset = source.firstIndex;
+        submesh.indexCount = source.indexCount;
+        if (source.isSkinned && !jointPoses.empty()) {
+            submesh.bounds = ComputeSkinnedBounds(vertices.data() + source.firstVertex, source.vertexCount, compactIBMs, jointPoses);
+            if (scene->mNumAnimations == 0) {
+                submesh.bounds.min = glm::min(submesh.bounds.min, submesh.bounds.center - glm::vec3(submesh.bounds.radius));
+                submesh.bounds.max = glm::max(submesh.bounds.max, submesh.bounds.center + glm::vec3(submesh.bounds.radius));
+            }
+        } else {
+            submesh.bounds = ComputeBounds([&](auto&& emit) {
+                for (uint32_t v = 0; v < source.vertexCount; ++v) {
+                    emit(vertices[source.firstVertex + v].position);
+                }
+            });
+        }
+        submeshes.push_back(submesh);
+    }
+
     // ============================================
     // Write output file
-    // Format: Header | Vertices | Indices | IBMs | joint_remaps
+    // Format: Header | Vertices | Indices | IBMs | joint_remaps | Submeshes
     // ============================================
     fs::path tempOutput = output;
     tempOutput += ".tmp";
@@ -888,6 +1131,8 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
         header.indexCount = static_cast<uint32_t>(indices.size());
         header.boneCount = static_cast<uint32_t>(compactIBMs.size());
         header.jointRemapCount = static_cast<uint32_t>(joint_remaps.size());
+        header.submeshCount = static_cast<uint32_t>(submeshes.size());
+        header.bounds = MergeBounds(submeshes);
 
         outFile.write(reinterpret_cast<const char*>(&header), sizeof(OakMeshHeader));
         outFile.write(reinterpret_cast<const char*>(vertices.data()), vertices.size() * sizeof(Vertex));
@@ -901,6 +1146,8 @@ bool CookMesh(const fs::path& input, const fs::path& output, float scale = 1.0f)
             outFile.write(reinterpret_cast<const char*>(joint_remaps.data()), joint_remaps.size() * sizeof(uint16_t));
         }
 
+        outFile.write(reinterpret_cast<const char*>(submeshes.data()), submeshes.size() * sizeof(OakMeshSubmesh));
+
         outFile.close();
 
         if (fs::exists(output)) fs::remove(output);
@@ -0,0 +1,138 @@
+#include "Fixtures.h"
+#include "Core/FrameAllocator.h"
+#include "Core/JobSystem.h"
+#include "Core/SystemScheduler.h"
+#include "Components/Components.h"
+#include "Animation/AnimGraph.h"
+#include "Systems/AnimationSystem.h"
+#include <benchmark/benchmark.h>
+#include <flecs.h>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // Two looping states. The switch to "B" fades over a transition long enough that every
+    // measured tick samples and blends both clips.
+    std::shared_ptr<Animation::AnimGraph> CreateBlendGraph(std::shared_ptr<Resources::Animation> a, std::shared_ptr<Resources::Animation> b) {
+        auto graph = std::make_shared<Animation::AnimGraph>();
+        graph->AddState("A", a);
+        graph->AddState("B", b);
+        graph->SetDefaultState("A");
+        graph->AddParameterBool("blend");
+        graph->AddTransition("A", "B", 1.0e6f);
+        graph->AddTransitionConditionBool("A", "B", "blend", true);
+        return graph;
+    }
+
+    // Idle/Walk/Run driven by a speed parameter, the usual locomotion setup
+    std::shared_ptr<Animation::AnimGraph> CreateLocomotionGraph(std::shared_ptr<Resources::Animation> clip) {
+        using Comparison = Animation::TransitionCondition::Comparison;
+
+        auto graph = std::make_shared<Animation::AnimGraph>();
+        graph->AddState("Idle", clip);
+        graph->AddState("Walk", clip, 1.2f);
+        graph->AddState("Run", clip, 1.8f);
+        graph->SetDefaultState("Idle");
+        graph->AddParameter("speed", Animation::AnimParameter::Type::Float);
+
+        graph->AddTransition("Idle", "Walk", 0.2f);
+        graph->AddTransitionCondition("Idle", "Walk", "speed", Comparison::Greater, 0.1f);
+        graph->AddTransition("Walk", "Idle", 0.2f);
+        graph->AddTransitionCondition("Walk", "Idle", "speed", Comparison::LessEquals, 0.1f);
+        graph->AddTransition("Walk", "Run", 0.3f);
+        graph->AddTransitionCondition("Walk", "Run", "speed", Comparison::Greater, 4.0f);
+        graph->AddTransition("Run", "Walk", 0.3f);
+        graph->AddTransitionCondition("Run", "Walk", "speed", Comparison::LessEquals, 4.0f);
+        return graph;
+    }
+
+}
+
+// AnimationSystem over N characters: sample (and for blend=1, cross-fade two clips), then
+// local-to-model. Args: character count, blend
+static void BM_AnimationSystem(benchmark::State& state) {
+    const int characterCount = static_cast<int>(state.range(0));
+    const bool blend = state.range(1) != 0;
+
+    Core::JobSystem jobs;
+    jobs.Init();
+
+    flecs::world world;
+    Core::SystemScheduler scheduler;
+    scheduler.Init(world, &jobs);
+
+    Systems::AnimationSystem animation(world);
+    animation.Schedule(scheduler);
+
+    auto skeleton = Bench::CreateSkeleton();
+    auto clipA = Bench::CreateAnimation(*skeleton, 1.0f, 0.5f);
+    auto clipB = Bench::CreateAnimation(*skeleton, 0.8f, 1.0f);
+    auto graph = CreateBlendGraph(clipA, clipB);
+
+    for (int i = 0; i < characterCount; ++i) {
+        AnimatorComponent animator;
+        animator.skeleton = skeleton;
+        if (blend) {
+            animator.animGraph = graph;
+            animator.graphInstance.Init(graph.get());
+            animator.graphInstance.SetBool("blend", true);
+        } else {
+            animator.animation = clipA;
+        }
+        animator.time = 0.01f * (i % 100); // Spread characters over the clip
+        world.entity().set<AnimatorComponent>(std::move(animator));
+    }
+
+    // First tick sizes the buffers and starts the transition
+    const float dt = 1.0f / 60.0f;
+    scheduler.Run(dt);
+    Core::FrameAllocator::ResetAll();
+
+    for (auto _ : state) {
+        scheduler.Run(dt);
+        Core::FrameAllocator::ResetAll();
+    }
+
+    state.counters["joints"] = static_cast<double>(skeleton->skeleton.num_joints());
+    state.counters["characters/s"] = benchmark::Counter(static_cast<double>(characterCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_AnimationSystem)
+    ->ArgNames({"characters", "blend"})
+    ->ArgsProduct({ {100, 1000}, {0, 1} })
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// AnimGraphInstance::Update on its own (parameter lookups, transition checks, state timing).
+// Speeds are varied so instances keep moving between states. Args: instance count
+static void BM_AnimGraphUpdate(benchmark::State& state) {
+    const int instanceCount = static_cast<int>(state.range(0));
+
+    auto skeleton = Bench::CreateSkeleton();
+    auto graph = CreateLocomotionGraph(Bench::CreateAnimation(*skeleton));
+
+    std::vector<Animation::AnimGraphInstance> instances(instanceCount);
+    for (auto& instance : instances) {
+        instance.Init(graph.get());
+    }
+
+    const float dt = 1.0f / 60.0f;
+    uint32_t tick = 0;
+    for (auto _ : state) {
+        for (int i = 0; i < instanceCount; ++i) {
+            // Each instance cycles idle -> walk -> run every 90 ticks, out of phase with its neighbours
+            float speed = static_cast<float>((tick + i) % 90) / 15.0f;
+            instances[i].SetFloat("speed", speed);
+            instances[i].Update(dt);
+        }
+        ++tick;
+    }
+
+    state.counters["updates/s"] = benchmark::Counter(static_cast<double>(instanceCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_AnimGraphUpdate)
+    ->ArgNames({"instances"})
+    ->Arg(100)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
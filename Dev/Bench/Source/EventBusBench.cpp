@@ -0,0 +1,62 @@
+#include "Core/EventBus.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+namespace {
+
+    struct BenchEvent {
+        uint64_t entity;
+        float value;
+    };
+
+}
+
+// EventBus::Publish, immediate delivery to every subscriber. Args: subscriber count
+static void BM_EventBusPublish(benchmark::State& state) {
+    const int subscriberCount = static_cast<int>(state.range(0));
+
+    Core::EventBus bus;
+    uint64_t received = 0;
+    for (int s = 0; s < subscriberCount; ++s) {
+        bus.Subscribe<BenchEvent>([&received](const BenchEvent& event) { received += event.entity; });
+    }
+
+    BenchEvent event{ 1, 0.5f };
+    for (auto _ : state) {
+        bus.Publish(event);
+        event.entity++;
+    }
+    benchmark::DoNotOptimize(received);
+
+    state.counters["deliveries/s"] = benchmark::Counter(static_cast<double>(subscriberCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_EventBusPublish)
+    ->ArgNames({"subscribers"})
+    ->Arg(1)
+    ->Arg(8)
+    ->Arg(64);
+
+// EventBus::Enqueue of a tick's worth of events, then one DispatchQueued to a batch subscriber.
+// Args: events per dispatch
+static void BM_EventBusQueued(benchmark::State& state) {
+    const int eventCount = static_cast<int>(state.range(0));
+
+    Core::EventBus bus;
+    uint64_t received = 0;
+    bus.SubscribeBatch<BenchEvent>([&received](std::span<const BenchEvent> events) { received += events.size(); });
+
+    for (auto _ : state) {
+        for (int i = 0; i < eventCount; ++i) {
+            bus.Enqueue(BenchEvent{ static_cast<uint64_t>(i), 1.0f });
+        }
+        bus.DispatchQueued();
+    }
+    benchmark::DoNotOptimize(received);
+
+    state.counters["events/s"] = benchmark::Counter(static_cast<double>(eventCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_EventBusQueued)
+    ->ArgNames({"events"})
+    ->Arg(100)
+    ->Arg(10000)
+    ->Unit(benchmark::kMicrosecond);
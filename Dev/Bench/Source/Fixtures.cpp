@@ -0,0 +1,83 @@
+#include "Fixtures.h"
+#include "Resources/Skeleton.h"
+#include "Resources/Animation.h"
+#include <ozz/animation/offline/raw_skeleton.h>
+#include <ozz/animation/offline/skeleton_builder.h>
+#include <ozz/animation/offline/raw_animation.h>
+#include <ozz/animation/offline/animation_builder.h>
+#include <ozz/base/maths/quaternion.h>
+#include <ozz/base/maths/transform.h>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <string>
+
+namespace Bench {
+
+    namespace {
+        std::atomic<bool> s_Failed{false};
+    }
+
+    void Fail(benchmark::State& state, const std::string& message) {
+        s_Failed = true;
+        state.SkipWithError(message.c_str());
+    }
+
+    bool HasFailed() {
+        return s_Failed;
+    }
+
+    std::shared_ptr<Resources::Skeleton> CreateSkeleton(int chains, int chainLength) {
+        using RawJoint = ozz::animation::offline::RawSkeleton::Joint;
+
+        ozz::animation::offline::RawSkeleton raw;
+        RawJoint& root = raw.roots.emplace_back();
+        root.name = "root";
+        root.transform = ozz::math::Transform::identity();
+
+        for (int c = 0; c < chains; ++c) {
+            RawJoint* parent = &root.children.emplace_back();
+            for (int j = 0; j < chainLength; ++j) {
+                parent->name = "chain" + std::to_string(c) + "_" + std::to_string(j);
+                parent->transform = ozz::math::Transform::identity();
+                parent->transform.translation = ozz::math::Float3(0.0f, 0.1f, 0.0f);
+                if (j + 1 < chainLength) {
+                    parent = &parent->children.emplace_back();
+                }
+            }
+        }
+
+        auto skeleton = std::make_shared<Resources::Skeleton>();
+        ozz::animation::offline::SkeletonBuilder builder;
+        if (auto built = builder(raw)) {
+            skeleton->skeleton = std::move(*built);
+        }
+        return skeleton;
+    }
+
+    std::shared_ptr<Resources::Animation> CreateAnimation(const Resources::Skeleton& skeleton, float duration, float swing) {
+        ozz::animation::offline::RawAnimation raw;
+        raw.duration = duration;
+        raw.tracks.resize(skeleton.skeleton.num_joints());
+
+        const int keyCount = std::max(2, static_cast<int>(duration * 30.0f) + 1);
+        for (auto& track : raw.tracks) {
+            track.translations.push_back({ 0.0f, ozz::math::Float3(0.0f, 0.1f, 0.0f) });
+            track.scales.push_back({ 0.0f, ozz::math::Float3::one() });
+            for (int k = 0; k < keyCount; ++k) {
+                float time = duration * k / (keyCount - 1);
+                float angle = swing * std::sin(6.2831853f * time / duration);
+                track.rotations.push_back({ time, ozz::math::Quaternion::FromAxisAngle(ozz::math::Float3::y_axis(), angle) });
+            }
+        }
+
+        auto animation = std::make_shared<Resources::Animation>();
+        ozz::animation::offline::AnimationBuilder builder;
+        if (auto built = builder(raw)) {
+            animation->animation = std::move(*built);
+        }
+        return animation;
+    }
+
+}
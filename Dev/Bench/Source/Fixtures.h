@@ -0,0 +1,26 @@
+#pragma once
+
+#include <memory>
+#include <string>
+
+namespace benchmark { class State; }
+
+namespace Resources {
+    class Skeleton;
+    class Animation;
+}
+
+namespace Bench {
+
+    // Stand-in for an imported character rig: a root with `chains` limbs of `chainLength` joints
+    std::shared_ptr<Resources::Skeleton> CreateSkeleton(int chains = 4, int chainLength = 16);
+
+    // Every joint swings about Y over `duration` seconds, with one key per 1/30 s
+    std::shared_ptr<Resources::Animation> CreateAnimation(const Resources::Skeleton& skeleton, float duration = 1.0f, float swing = 0.5f);
+
+    // For checks a benchmark runs before timing: skips it with `message` and makes OakenBench exit with 1,
+    // so a CI run fails instead of just reporting a skipped benchmark
+    void Fail(benchmark::State& state, const std::string& message);
+    bool HasFailed();
+
+}
@@ -0,0 +1,79 @@
+#include "Core/Context.h"
+#include "Core/JobSystem.h"
+#include "Components/Components.h"
+#include "Systems/PhysicsSystem.h"
+#include <benchmark/benchmark.h>
+#include <flecs.h>
+#include <cmath>
+
+namespace {
+
+    // Ground slab plus a grid of dynamic boxes dropped just above it
+    void CreateBoxScene(flecs::world& world, int boxCount) {
+        int side = static_cast<int>(std::ceil(std::sqrt(static_cast<float>(boxCount))));
+        float spacing = 1.5f;
+        float extent = side * spacing * 0.5f;
+
+        world.entity("Ground")
+            .set<LocalTransform>({ {0.0f, -0.5f, 0.0f} })
+            .set<Collider>({ ColliderType::Box, {extent + 10.0f, 0.5f, extent + 10.0f} })
+            .set<RigidBody>({ MotionType::Static });
+
+        for (int i = 0; i < boxCount; ++i) {
+            float x = (i % side) * spacing - extent;
+            float z = (i / side) * spacing - extent;
+            float y = 1.0f + (i % 3) * 0.5f;
+
+            world.entity()
+                .set<LocalTransform>({ {x, y, z} })
+                .set<Collider>({ ColliderType::Box, {0.5f, 0.5f, 0.5f} })
+                .set<RigidBody>({ MotionType::Dynamic });
+        }
+    }
+
+}
+
+// PhysicsSystem::Step scaling with the number of threads Jolt may use.
+// Args: threads, dynamic box count
+static void BM_PhysicsStep(benchmark::State& state) {
+    const uint32_t threadCount = static_cast<uint32_t>(state.range(0));
+    const int boxCount = static_cast<int>(state.range(1));
+
+    Core::JobSystem jobs;
+    if (threadCount > 1) {
+        jobs.Init(threadCount - 1);
+    }
+
+    flecs::world world;
+    Core::GameContext context;
+    context.World = &world;
+    context.Jobs = threadCount > 1 ? &jobs : nullptr;
+
+    Systems::PhysicsSystem physics(context);
+    physics.SetThreadCount(threadCount);
+    physics.Init();
+
+    CreateBoxScene(world, boxCount);
+
+    // First step creates the bodies; keep it out of the measurement
+    const float dt = 1.0f / 60.0f;
+    physics.Step(dt);
+
+    for (auto _ : state) {
+        physics.Step(dt);
+    }
+
+    state.counters["bodies"] = static_cast<double>(boxCount);
+    state.counters["steps/s"] = benchmark::Counter(static_cast<double>(state.iterations()), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_PhysicsStep)
+    ->ArgNames({"threads", "boxes"})
+    ->Args({4, 1000})
+    ->Args({1, 10000})
+    ->Args({2, 10000})
+    ->Args({4, 10000})
+    ->Args({8, 10000})
+    ->Args({8, 50000})
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime()
+    ->Iterations(120);
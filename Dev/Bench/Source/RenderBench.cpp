@@ -0,0 +1,252 @@
+#include "Fixtures.h"
+#include "Core/Context.h"
+#include "Core/JobSystem.h"
+#include "Components/Components.h"
+#include "Resources/Mesh.h"
+#include "Systems/FrustumCulling.h"
+#include "Systems/RenderSystem.h"
+#include <benchmark/benchmark.h>
+#include <flecs.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <string>
+#include <vector>
+
+// Extraction only reads the world and fills a RenderSnapshot, so the RenderSystem is never Init()ed
+// and no GPU device is created. Meshes are empty handles.
+namespace {
+
+    std::shared_ptr<Resources::Mesh> CreateEmptyMesh() {
+        return std::make_shared<Resources::Mesh>(nullptr, nullptr, nullptr, 0, 0);
+    }
+
+    glm::mat4 GridTransform(int i) {
+        glm::mat4 model(1.0f);
+        model[3] = glm::vec4(static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100), 1.0f);
+        return model;
+    }
+
+}
+
+// Static mesh batching (RenderSystem::ExtractMeshes). Nothing moves, so after the first extraction
+// every instance keeps its slot and none is sent again ("updated" should be 0).
+// Args: instance count, distinct meshes
+static void BM_ExtractBatches(benchmark::State& state) {
+    const int instanceCount = static_cast<int>(state.range(0));
+    const int meshCount = static_cast<int>(state.range(1));
+
+    flecs::world world;
+    Core::GameContext context;
+    context.World = &world;
+
+    Platform::RenderDevice device;
+    Resources::ResourceManager resources;
+    Systems::RenderSystem renderer(context, device, resources);
+
+    std::vector<std::shared_ptr<Resources::Mesh>> meshes;
+    for (int m = 0; m < meshCount; ++m) {
+        meshes.push_back(CreateEmptyMesh());
+    }
+    for (int i = 0; i < instanceCount; ++i) {
+        world.entity()
+            .set<WorldTransform>({ GridTransform(i) })
+            .set<MeshComponent>({ meshes[i % meshCount] });
+    }
+
+    Systems::RenderSnapshot snapshot;
+    for (auto _ : state) {
+        renderer.Extract(snapshot, 1.0, false, false);
+        benchmark::DoNotOptimize(snapshot.instances.data());
+    }
+
+    state.counters["batches"] = static_cast<double>(snapshot.batches.size());
+    state.counters["updated"] = static_cast<double>(snapshot.instances.size());
+    state.counters["instances/s"] = benchmark::Counter(static_cast<double>(instanceCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ExtractBatches)
+    ->ArgNames({"instances", "meshes"})
+    ->ArgsProduct({ {1000, 10000, 100000}, {1, 64} })
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Extraction after every instance of one mesh was destroyed: the emptied batch is dropped and the
+// rest are laid out again. Before timing, the run fails unless the batch count and slot span drop.
+// Args: instances per mesh
+static void BM_RemoveStaticBatch(benchmark::State& state) {
+    const int instanceCount = static_cast<int>(state.range(0));
+
+    flecs::world world;
+    Core::GameContext context;
+    context.World = &world;
+
+    Platform::RenderDevice device;
+    Resources::ResourceManager resources;
+    Systems::RenderSystem renderer(context, device, resources);
+
+    auto kept = CreateEmptyMesh();
+    auto removed = CreateEmptyMesh();
+    for (int i = 0; i < instanceCount; ++i) {
+        world.entity()
+            .set<WorldTransform>({ GridTransform(i) })
+            .set<MeshComponent>({ kept });
+    }
+
+    std::vector<flecs::entity> entities;
+    auto spawnRemoved = [&]() {
+        entities.clear();
+        for (int i = 0; i < instanceCount; ++i) {
+            entities.push_back(world.entity()
+                .set<WorldTransform>({ GridTransform(i) })
+                .set<MeshComponent>({ removed }));
+        }
+    };
+    auto destroyRemoved = [&]() {
+        for (flecs::entity e : entities) {
+            e.destruct();
+        }
+    };
+
+    Systems::RenderSnapshot snapshot;
+    spawnRemoved();
+    renderer.Extract(snapshot, 1.0, false, false);
+    const size_t batchesBefore = snapshot.batches.size();
+    const uint32_t slotsBefore = snapshot.instanceSlots;
+    destroyRemoved();
+    renderer.Extract(snapshot, 1.0, false, false);
+    if (batchesBefore != 2 || snapshot.batches.size() != 1 || snapshot.instanceSlots >= slotsBefore) {
+        Bench::Fail(state, "Batches went from " + std::to_string(batchesBefore) + " to " + std::to_string(snapshot.batches.size())
+            + ", slots from " + std::to_string(slotsBefore) + " to " + std::to_string(snapshot.instanceSlots));
+        return;
+    }
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        spawnRemoved();
+        renderer.Extract(snapshot, 1.0, false, false);
+        destroyRemoved();
+        state.ResumeTiming();
+
+        renderer.Extract(snapshot, 1.0, false, false);
+        benchmark::DoNotOptimize(snapshot.instances.data());
+    }
+
+    state.counters["batches"] = static_cast<double>(snapshot.batches.size());
+    state.counters["updated"] = static_cast<double>(snapshot.instances.size());
+}
+BENCHMARK(BM_RemoveStaticBatch)
+    ->ArgNames({"instances"})
+    ->Arg(1000)->Arg(10000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Skin palette construction for posed characters, spread over the job system.
+// Args: character count, joints per character
+static void BM_SkinPalettes(benchmark::State& state) {
+    const int characterCount = static_cast<int>(state.range(0));
+    const int jointCount = static_cast<int>(state.range(1));
+
+    Core::JobSystem jobs;
+    jobs.Init();
+
+    flecs::world world;
+    Core::GameContext context;
+    context.World = &world;
+    context.Jobs = &jobs;
+
+    Platform::RenderDevice device;
+    Resources::ResourceManager resources;
+    Systems::RenderSystem renderer(context, device, resources);
+
+    // One chain per 16 joints, rounded up
+    auto skeleton = Bench::CreateSkeleton((jointCount + 15) / 16, 16);
+    const int skeletonJoints = skeleton->skeleton.num_joints();
+
+    // Skins every joint, like a fully weighted character
+    auto mesh = CreateEmptyMesh();
+    std::vector<glm::mat4> inverseBindMatrices(skeletonJoints, glm::mat4(1.0f));
+    std::vector<uint16_t> jointRemaps(skeletonJoints);
+    for (int j = 0; j < skeletonJoints; ++j) {
+        jointRemaps[j] = static_cast<uint16_t>(j);
+    }
+    mesh->SetSkinning(std::move(inverseBindMatrices), std::move(jointRemaps));
+
+    for (int i = 0; i < characterCount; ++i) {
+        AnimatorComponent animator;
+        animator.skeleton = skeleton;
+        animator.models.assign(skeletonJoints, ozz::math::Float4x4::identity());
+        world.entity()
+            .set<WorldTransform>({ GridTransform(i) })
+            .set<MeshComponent>({ mesh })
+            .set<AnimatorComponent>(std::move(animator));
+    }
+
+    Systems::RenderSnapshot snapshot;
+    for (auto _ : state) {
+        renderer.Extract(snapshot, 1.0, false, false);
+        benchmark::DoNotOptimize(snapshot.skinPalettes.data());
+    }
+
+    state.counters["joints"] = static_cast<double>(skeletonJoints);
+    state.counters["paletteKB"] = static_cast<double>(snapshot.skinPalettes.size() * sizeof(glm::mat4)) / 1024.0;
+    state.counters["palettes/s"] = benchmark::Counter(static_cast<double>(characterCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_SkinPalettes)
+    ->ArgNames({"characters", "joints"})
+    ->ArgsProduct({ {100, 1000}, {32, 128} })
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
+
+// Frustum culling of world boxes for one view (FrustumCulling::Cull). Boxes are scattered all around
+// a camera at the origin, so most are behind or beside it. Before timing, the result is checked
+// against the scalar path and the run fails on any disagreement.
+// Args: path (0 scalar, 1 SSE2, 2 AVX2), box count
+static void BM_FrustumCull(benchmark::State& state) {
+    const auto path = static_cast<Systems::TransformBatch::Path>(state.range(0));
+    const uint32_t count = static_cast<uint32_t>(state.range(1));
+    state.SetLabel(Systems::TransformBatch::GetPathName(path));
+
+    if (!Systems::TransformBatch::IsSupported(path)) {
+        state.SkipWithError("Path not supported on this CPU");
+        return;
+    }
+
+    std::mt19937 rng(11);
+    auto next = [&rng](float lo, float hi) { return lo + (hi - lo) * static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f); };
+    Systems::CullBounds bounds;
+    bounds.Resize(count);
+    for (uint32_t i = 0; i < count; ++i) {
+        glm::vec3 center(next(-150.0f, 150.0f), next(-10.0f, 30.0f), next(-150.0f, 150.0f));
+        glm::vec3 extent(next(0.1f, 4.0f), next(0.1f, 4.0f), next(0.1f, 4.0f));
+        bounds.Set(i, center, extent);
+    }
+
+    glm::mat4 view = glm::lookAt(glm::vec3(0.0f, 2.0f, 0.0f), glm::vec3(1.0f, 1.5f, -3.0f), glm::vec3(0.0f, 1.0f, 0.0f));
+    glm::mat4 proj = glm::perspectiveRH_ZO(glm::radians(60.0f), 16.0f / 9.0f, 0.1f, 100.0f);
+    Systems::Frustum frustum = Systems::Frustum::FromMatrix(proj * view);
+
+    std::vector<uint8_t> visible(count);
+    std::vector<uint8_t> reference(count);
+    Systems::FrustumCulling::Cull(Systems::TransformBatch::Path::Scalar, frustum, bounds, 0, count, reference.data());
+    Systems::FrustumCulling::Cull(path, frustum, bounds, 0, count, visible.data());
+    uint32_t visibleCount = 0;
+    for (uint32_t i = 0; i < count; ++i) {
+        if (visible[i] != reference[i]) {
+            Bench::Fail(state, "Box " + std::to_string(i) + " differs from the scalar path");
+            return;
+        }
+        visibleCount += visible[i];
+    }
+
+    for (auto _ : state) {
+        Systems::FrustumCulling::Cull(path, frustum, bounds, 0, count, visible.data());
+        benchmark::DoNotOptimize(visible.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["visible"] = static_cast<double>(visibleCount);
+    state.counters["boxes/s"] = benchmark::Counter(static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_FrustumCull)
+    ->ArgNames({"path", "boxes"})
+    ->ArgsProduct({ {0, 1, 2}, {1003, 100000} })
+    ->Unit(benchmark::kMicrosecond);
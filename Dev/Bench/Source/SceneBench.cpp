@@ -0,0 +1,91 @@
+#include "Components/Components.h"
+#include "Scene/Scene.h"
+#include "Scene/SceneSerializer.h"
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+namespace {
+
+    // Same layout the AssetCooker writes for .oaklevel files
+    struct OakLevelHeader {
+        char signature[4] = {'O', 'A', 'K', 'L'};
+        uint32_t version = 1;
+        uint32_t entityCount = 0;
+    };
+
+    struct OakLevelTransform {
+        glm::vec3 position = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 rotation = { 0.0f, 0.0f, 0.0f };
+        glm::vec3 scale = { 1.0f, 1.0f, 1.0f };
+    };
+
+    void WriteLevel(const std::string& path, uint32_t entityCount) {
+        std::ofstream out(path, std::ios::binary);
+
+        OakLevelHeader header;
+        header.entityCount = entityCount;
+        out.write(reinterpret_cast<const char*>(&header), sizeof(OakLevelHeader));
+
+        for (uint32_t i = 0; i < entityCount; ++i) {
+            std::string name = "Entity" + std::to_string(i);
+            uint32_t nameLen = static_cast<uint32_t>(name.length());
+            out.write(reinterpret_cast<const char*>(&nameLen), sizeof(uint32_t));
+            out.write(name.c_str(), nameLen);
+
+            bool hasTransform = true;
+            out.write(reinterpret_cast<const char*>(&hasTransform), sizeof(bool));
+            OakLevelTransform transform;
+            transform.position = { static_cast<float>(i % 100), 0.0f, static_cast<float>(i / 100) };
+            out.write(reinterpret_cast<const char*>(&transform), sizeof(OakLevelTransform));
+
+            // No sprite, no mesh: mesh loading would measure the ResourceManager instead
+            bool hasSprite = false;
+            bool hasMesh = false;
+            out.write(reinterpret_cast<const char*>(&hasSprite), sizeof(bool));
+            out.write(reinterpret_cast<const char*>(&hasMesh), sizeof(bool));
+        }
+    }
+
+}
+
+// SceneSerializer::DeserializeBinary into a fresh scene. Args: entity count
+static void BM_DeserializeBinary(benchmark::State& state) {
+    const uint32_t entityCount = static_cast<uint32_t>(state.range(0));
+
+    std::filesystem::path path = std::filesystem::temp_directory_path() / ("OakenBench_" + std::to_string(entityCount) + ".oaklevel");
+    WriteLevel(path.string(), entityCount);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        auto scene = std::make_unique<Core::Scene>();
+        scene->Init();
+        state.ResumeTiming();
+
+        Core::SceneSerializer serializer(scene.get());
+        if (!serializer.DeserializeBinary(path.string())) {
+            state.SkipWithError("DeserializeBinary failed");
+            break;
+        }
+
+        // Tearing the world down is not part of loading
+        state.PauseTiming();
+        scene.reset();
+        state.ResumeTiming();
+    }
+
+    std::error_code ec;
+    std::filesystem::remove(path, ec);
+
+    state.counters["entities/s"] = benchmark::Counter(static_cast<double>(entityCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_DeserializeBinary)
+    ->ArgNames({"entities"})
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Arg(100000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
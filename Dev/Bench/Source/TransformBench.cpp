@@ -0,0 +1,171 @@
+#include "Fixtures.h"
+#include "Core/Context.h"
+#include "Core/JobSystem.h"
+#include "Core/SystemScheduler.h"
+#include "Components/Components.h"
+#include "Systems/TransformBatch.h"
+#include "Systems/TransformSystem.h"
+#include <benchmark/benchmark.h>
+#include <flecs.h>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+    // `entityCount` entities in chains of `depth`: every chain starts at a root, each
+    // following entity is a child of the previous one
+    void CreateHierarchy(flecs::world& world, int entityCount, int depth) {
+        flecs::entity parent;
+        for (int i = 0; i < entityCount; ++i) {
+            float offset = static_cast<float>(i % 100);
+            flecs::entity e = world.entity()
+                .set<LocalTransform>(LocalTransform::FromEuler({offset, 0.5f, 0.0f}, {0.0f, 10.0f, 0.0f}));
+            if (i % depth != 0) {
+                e.child_of(parent);
+            }
+            parent = e;
+        }
+    }
+
+    std::vector<LocalTransform> CreateRandomTransforms(int count) {
+        std::mt19937 rng(7);
+        auto next = [&rng](float lo, float hi) { return lo + (hi - lo) * static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f); };
+
+        std::vector<LocalTransform> locals(count);
+        for (LocalTransform& local : locals) {
+            local.position = { next(-100.0f, 100.0f), next(-100.0f, 100.0f), next(-100.0f, 100.0f) };
+            local.rotation = EulerToQuat({ next(-720.0f, 720.0f), next(-720.0f, 720.0f), next(-720.0f, 720.0f) });
+            local.scale = { next(0.1f, 4.0f), next(0.1f, 4.0f), next(0.1f, 4.0f) };
+        }
+        // Quarter turns, where most quaternion components are zero and a sign mistake would show
+        const float quarterTurns[] = { 0.0f, 90.0f, 180.0f, 270.0f, -90.0f, 360.0f, 45.0f, -45.0f };
+        for (int i = 0; i < std::min(count, 8); ++i) {
+            locals[i].rotation = EulerToQuat({ quarterTurns[i], quarterTurns[(i + 3) % 8], quarterTurns[(i + 5) % 8] });
+        }
+        return locals;
+    }
+
+    // Largest difference from the glm path, in units of float epsilon scaled by the column's largest
+    // element (at least 1), so translations don't hide errors in the rotation
+    float MaxErrorFromScalar(const std::vector<LocalTransform>& locals, const std::vector<WorldTransform>& worlds, const glm::mat4* parent) {
+        float maxError = 0.0f;
+        for (size_t i = 0; i < locals.size(); ++i) {
+            glm::mat4 reference = Systems::TransformBatch::ComposeScalar(locals[i]);
+            if (parent) {
+                reference = *parent * reference;
+            }
+            for (int c = 0; c < 4; ++c) {
+                float scale = 1.0f;
+                for (int r = 0; r < 4; ++r) {
+                    scale = std::max(scale, std::abs(reference[c][r]));
+                }
+                for (int r = 0; r < 4; ++r) {
+                    float error = std::abs(worlds[i].matrix[c][r] - reference[c][r]) / (scale * std::numeric_limits<float>::epsilon());
+                    maxError = std::max(maxError, error);
+                }
+            }
+        }
+        return maxError;
+    }
+
+}
+
+// TransformBatch::Compose on one run of transforms. Before timing, the result is checked against the
+// scalar glm path and OakenBench fails if any element is further off than the tolerance below.
+// Args: path (0 scalar, 1 SSE2, 2 AVX2), transform count, whether a parent matrix is applied
+static void BM_ComposeTransforms(benchmark::State& state) {
+    const auto path = static_cast<Systems::TransformBatch::Path>(state.range(0));
+    const int count = static_cast<int>(state.range(1));
+    const bool withParent = state.range(2) != 0;
+    state.SetLabel(Systems::TransformBatch::GetPathName(path));
+
+    if (!Systems::TransformBatch::IsSupported(path)) {
+        state.SkipWithError("Path not supported on this CPU");
+        return;
+    }
+
+    std::vector<LocalTransform> locals = CreateRandomTransforms(count);
+    std::vector<WorldTransform> worlds(count);
+    LocalTransform parentLocal = LocalTransform::FromEuler({1.0f, 2.0f, 3.0f}, {30.0f, 40.0f, 50.0f}, {1.0f, 2.0f, 0.5f});
+    glm::mat4 parentMatrix = Systems::TransformBatch::ComposeScalar(parentLocal);
+    const glm::mat4* parent = withParent ? &parentMatrix : nullptr;
+
+    Systems::TransformBatch::Compose(path, locals.data(), worlds.data(), static_cast<uint32_t>(count), parent);
+    float maxError = MaxErrorFromScalar(locals, worlds, parent);
+    state.counters["maxErrorEps"] = maxError;
+    // The SSE2 kernel does glm's operations in glm's order, so it must match bit for bit. AVX2 fuses
+    // the multiply-adds, which rounds differently: up to ~6 epsilon measured over these transforms.
+    const float tolerance = path == Systems::TransformBatch::Path::AVX2 ? 8.0f : 0.0f;
+    if (maxError > tolerance) {
+        Bench::Fail(state, "Differs from the scalar path by " + std::to_string(maxError) + " epsilon");
+        return;
+    }
+
+    for (auto _ : state) {
+        Systems::TransformBatch::Compose(path, locals.data(), worlds.data(), static_cast<uint32_t>(count), parent);
+        benchmark::DoNotOptimize(worlds.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.counters["transforms/s"] = benchmark::Counter(static_cast<double>(count) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_ComposeTransforms)
+    ->ArgNames({"path", "count", "parent"})
+    ->ArgsProduct({ {0, 1, 2}, {1003, 100000}, {0, 1} })
+    ->Unit(benchmark::kMicrosecond);
+
+// TransformSystem propagation (changed roots on every thread, then the hierarchy in cascade order).
+// Args: entity count, hierarchy depth, whether every root moves each tick (0 measures a static scene,
+// which should only cost the per-table change checks)
+static void BM_TransformPropagation(benchmark::State& state) {
+    const int entityCount = static_cast<int>(state.range(0));
+    const int depth = static_cast<int>(state.range(1));
+    const bool moving = state.range(2) != 0;
+
+    Core::JobSystem jobs;
+    jobs.Init();
+
+    flecs::world world;
+    Core::GameContext context;
+    context.World = &world;
+    context.Jobs = &jobs;
+
+    Systems::TransformSystem transforms(context);
+    transforms.Init();
+
+    Core::SystemScheduler scheduler;
+    scheduler.Init(world, &jobs);
+    transforms.Schedule(scheduler);
+
+    CreateHierarchy(world, entityCount, depth);
+
+    // Iterating LocalTransform for writing marks the roots' tables changed, like a gameplay system would
+    const glm::quat step = glm::angleAxis(glm::radians(1.0f), glm::vec3(0, 1, 0));
+    flecs::query<LocalTransform> roots = world.query_builder<LocalTransform>()
+        .without(flecs::ChildOf, flecs::Wildcard)
+        .build();
+
+    // First run attaches the WorldTransforms; keep it out of the measurement
+    const float dt = 1.0f / 60.0f;
+    scheduler.Run(dt);
+
+    for (auto _ : state) {
+        if (moving) {
+            state.PauseTiming();
+            roots.each([&step](LocalTransform& transform) { transform.rotation = glm::normalize(step * transform.rotation); });
+            state.ResumeTiming();
+        }
+        scheduler.Run(dt);
+    }
+
+    state.counters["entities/s"] = benchmark::Counter(static_cast<double>(entityCount) * state.iterations(), benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_TransformPropagation)
+    ->ArgNames({"entities", "depth", "moving"})
+    ->ArgsProduct({ {1000, 10000, 100000}, {1, 4, 8}, {0, 1} })
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -0,0 +1,22 @@
+#include "Fixtures.h"
+#include "Core/Log.h"
+#include <benchmark/benchmark.h>
+
+// Runs headless. For machine-readable results pass --benchmark_out=<file> (JSON by default);
+// two such files can be diffed with benchmark's tools/compare.py. Exits with 1 when a benchmark's
+// correctness check failed.
+int main(int argc, char** argv) {
+    Core::Log::Init();
+    // Keep engine chatter out of the timings
+    Core::Log::GetCoreLogger()->set_level(spdlog::level::warn);
+    Core::Log::GetClientLogger()->set_level(spdlog::level::warn);
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+    benchmark::RunSpecifiedBenchmarks();
+    benchmark::Shutdown();
+    Core::Log::Shutdown();
+    return Bench::HasFailed() ? 1 : 0;
+}
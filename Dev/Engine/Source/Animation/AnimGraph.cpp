@@ -275,9 +275,10 @@ namespace Animation {
         return std::clamp(transitionTime / transitionDuration, 0.0f, 1.0f);
     }
 
-    std::vector<AnimGraphInstance::AnimationSample> AnimGraphInstance::GetCurrentSamples() const {
-        std::vector<AnimationSample> samples;
+    Core::FrameVector<AnimGraphInstance::AnimationSample> AnimGraphInstance::GetCurrentSamples() const {
+        Core::FrameVector<AnimationSample> samples;
         if (!graph) return samples;
+        samples.reserve(2);
         
         float blendWeight = GetBlendWeight();
         
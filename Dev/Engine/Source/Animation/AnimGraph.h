@@ -5,6 +5,7 @@
 #include <unordered_map>
 #include <memory>
 #include <functional>
+#include "../Core/FrameAllocator.h"
 #include "../Resources/Animation.h"
 
 namespace Animation {
@@ -119,7 +120,8 @@ namespace Animation {
             float weight;
             bool loop;
         };
-        std::vector<AnimationSample> GetCurrentSamples() const;
+        // Frame memory: only valid until the end of the frame
+        Core::FrameVector<AnimationSample> GetCurrentSamples() const;
     };
 
 } // namespace Animation
@@ -2,6 +2,8 @@
 
 #include <flecs.h>
 #include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <cmath>
 #include <string>
 #include <memory>
 #include <ozz/base/containers/vector.h>
@@ -17,16 +19,54 @@ namespace Resources {
     class Mesh;
 }
 
+// Euler angles in degrees <-> rotation, applied X, then Y, then Z in the parent frame (R = Rx * Ry * Rz).
+// Only files and tools speak Euler; the runtime keeps the quaternion.
+inline glm::quat EulerToQuat(const glm::vec3& degrees) {
+    glm::vec3 radians = glm::radians(degrees);
+    return glm::angleAxis(radians.x, glm::vec3(1, 0, 0))
+         * glm::angleAxis(radians.y, glm::vec3(0, 1, 0))
+         * glm::angleAxis(radians.z, glm::vec3(0, 0, 1));
+}
+
+inline glm::vec3 QuatToEuler(const glm::quat& rotation) {
+    glm::mat3 m = glm::mat3_cast(rotation); // m[column][row]
+    float cosY = std::sqrt(m[0][0] * m[0][0] + m[1][0] * m[1][0]);
+    float y = std::atan2(m[2][0], cosY);
+    if (cosY > 1e-6f) {
+        return glm::degrees(glm::vec3(std::atan2(-m[2][1], m[2][2]), y, std::atan2(-m[1][0], m[0][0])));
+    }
+    // Gimbal lock: X and Z turn about the same axis, fold it all into X
+    return glm::degrees(glm::vec3(std::atan2(m[2][0] > 0.0f ? m[0][1] : -m[0][1], m[1][1]), y, 0.0f));
+}
+
 struct LocalTransform {
     glm::vec3 position = {0.0f, 0.0f, 0.0f};
-    glm::vec3 rotation = {0.0f, 0.0f, 0.0f}; // Euler angles in degrees
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f); // Normalized
     glm::vec3 scale = {1.0f, 1.0f, 1.0f};
+
+    static LocalTransform FromEuler(const glm::vec3& position, const glm::vec3& eulerDegrees = glm::vec3(0.0f), const glm::vec3& scale = glm::vec3(1.0f)) {
+        return { position, EulerToQuat(eulerDegrees), scale };
+    }
 };
 
+// Camera orientation from yaw (Y), then pitch (X), then roll (Z), the order cameras and benchmark keys use
+inline glm::quat CameraRotation(float pitchDegrees, float yawDegrees, float rollDegrees = 0.0f) {
+    return glm::angleAxis(glm::radians(yawDegrees), glm::vec3(0, 1, 0))
+         * glm::angleAxis(glm::radians(pitchDegrees), glm::vec3(1, 0, 0))
+         * glm::angleAxis(glm::radians(rollDegrees), glm::vec3(0, 0, 1));
+}
+
 struct WorldTransform {
     glm::mat4 matrix = glm::mat4(1.0f);
 };
 
+// WorldTransform as of the previous fixed tick, so rendering can interpolate between ticks.
+// Runtime only, added alongside WorldTransform.
+struct PreviousWorldTransform {
+    glm::mat4 matrix = glm::mat4(1.0f);
+    bool valid = false; // Render the current transform until a tick is recorded. Clear it to snap after a teleport.
+};
+
 struct SpriteComponent {
     std::shared_ptr<Resources::Texture> texture;
     glm::vec4 color = {1.0f, 1.0f, 1.0f, 1.0f};
@@ -69,6 +109,14 @@ struct CameraComponent {
     float orthoSize = 10.0f; // Half-height in world units for ortho projection
 };
 
+// Camera LocalTransform as of the previous fixed tick (the view is built from LocalTransform).
+// Runtime only, added alongside CameraComponent.
+struct PreviousCameraTransform {
+    glm::vec3 position = {0.0f, 0.0f, 0.0f};
+    glm::quat rotation = glm::quat(1.0f, 0.0f, 0.0f, 0.0f);
+    bool valid = false;
+};
+
 // Third-person orbit camera that follows a target entity
 struct CameraFollowComponent {
     flecs::entity target;       // Entity to follow
@@ -20,12 +20,27 @@ namespace Components {
             .member<float>("y")
             .member<float>("z");
 
+        // Rotations show up as Euler degrees (see QuatToEuler), the same view the scene files use
+        world.component<glm::quat>()
+            .opaque(world.component<glm::vec3>())
+            .serialize([](const flecs::serializer *s, const glm::quat *data) {
+                glm::vec3 euler = QuatToEuler(*data);
+                s->member("x");
+                s->value(euler.x);
+                s->member("y");
+                s->value(euler.y);
+                s->member("z");
+                return s->value(euler.z);
+            });
+
         world.component<LocalTransform>()
             .member<glm::vec3>("position")
-            .member<glm::vec3>("rotation")
+            .member<glm::quat>("rotation")
             .member<glm::vec3>("scale");
 
         world.component<WorldTransform>();
+        world.component<PreviousWorldTransform>();
+        world.component<PreviousCameraTransform>();
 
         world.component<MeshComponent>()
             .member<uint32_t>("meshId")
@@ -0,0 +1,107 @@
+#include "AllocationTracker.h"
+
+#ifdef OAKEN_TRACK_ALLOCATIONS
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+#ifdef OAKEN_TRACY_MEMORY
+#include <tracy/Tracy.hpp>
+#define OAKEN_TRACE_ALLOC(ptr, size) TracyAlloc(ptr, size)
+#define OAKEN_TRACE_FREE(ptr) TracyFree(ptr)
+#else
+#define OAKEN_TRACE_ALLOC(ptr, size)
+#define OAKEN_TRACE_FREE(ptr)
+#endif
+
+namespace {
+    std::atomic<uint64_t> s_AllocationCount{0};
+    std::atomic<uint64_t> s_AllocatedBytes{0};
+
+    void* TrackedAlloc(std::size_t size, std::size_t alignment) {
+        s_AllocationCount.fetch_add(1, std::memory_order_relaxed);
+        s_AllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+        if (size == 0) size = 1;
+        void* ptr;
+        if (alignment <= alignof(std::max_align_t)) {
+            ptr = std::malloc(size);
+        } else {
+#ifdef _WIN32
+            ptr = _aligned_malloc(size, alignment);
+#else
+            ptr = std::aligned_alloc(alignment, (size + alignment - 1) & ~(alignment - 1));
+#endif
+        }
+        OAKEN_TRACE_ALLOC(ptr, size);
+        return ptr;
+    }
+
+    // Plain new/delete stay on malloc/free so blocks can cross module boundaries
+    void TrackedFree(void* ptr) noexcept {
+        OAKEN_TRACE_FREE(ptr);
+        std::free(ptr);
+    }
+
+    void TrackedAlignedFree(void* ptr, std::size_t alignment) noexcept {
+        OAKEN_TRACE_FREE(ptr);
+#ifdef _WIN32
+        if (alignment > alignof(std::max_align_t)) {
+            _aligned_free(ptr);
+            return;
+        }
+#endif
+        (void)alignment;
+        std::free(ptr);
+    }
+}
+
+void* operator new(std::size_t size) {
+    if (void* ptr = TrackedAlloc(size, alignof(std::max_align_t))) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size) {
+    if (void* ptr = TrackedAlloc(size, alignof(std::max_align_t))) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = TrackedAlloc(size, static_cast<std::size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+    if (void* ptr = TrackedAlloc(size, static_cast<std::size_t>(alignment))) return ptr;
+    throw std::bad_alloc();
+}
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAlloc(size, alignof(std::max_align_t));
+}
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept {
+    return TrackedAlloc(size, alignof(std::max_align_t));
+}
+
+void operator delete(void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { TrackedFree(ptr); }
+void operator delete(void* ptr, std::align_val_t alignment) noexcept { TrackedAlignedFree(ptr, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* ptr, std::align_val_t alignment) noexcept { TrackedAlignedFree(ptr, static_cast<std::size_t>(alignment)); }
+void operator delete(void* ptr, std::size_t, std::align_val_t alignment) noexcept { TrackedAlignedFree(ptr, static_cast<std::size_t>(alignment)); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t alignment) noexcept { TrackedAlignedFree(ptr, static_cast<std::size_t>(alignment)); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedFree(ptr); }
+
+namespace Core {
+    bool AllocationTracker::IsEnabled() { return true; }
+    uint64_t AllocationTracker::GetAllocationCount() { return s_AllocationCount.load(std::memory_order_relaxed); }
+    uint64_t AllocationTracker::GetAllocatedBytes() { return s_AllocatedBytes.load(std::memory_order_relaxed); }
+}
+
+#else
+
+namespace Core {
+    bool AllocationTracker::IsEnabled() { return false; }
+    uint64_t AllocationTracker::GetAllocationCount() { return 0; }
+    uint64_t AllocationTracker::GetAllocatedBytes() { return 0; }
+}
+
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstdint>
+
+namespace Core {
+
+    // Counts calls to the global operator new when the engine is built with OAKEN_TRACK_ALLOCATIONS.
+    // Engine::Step diffs the counter around each frame, so a steady-state frame should read zero.
+    // On Windows the replacement only sees allocations made from the engine DLL.
+    struct AllocationTracker {
+        static bool IsEnabled();
+        static uint64_t GetAllocationCount();
+        static uint64_t GetAllocatedBytes();
+    };
+
+}
@@ -0,0 +1,179 @@
+#include "Benchmark.h"
+#include "Log.h"
+#include "Telemetry.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #define NOMINMAX
+    #include <windows.h>
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+using json = nlohmann::json;
+
+namespace Core {
+
+    namespace {
+        glm::vec3 ReadVec3(const json& value, const glm::vec3& fallback) {
+            if (!value.is_array() || value.size() != 3) return fallback;
+            return { value[0].get<float>(), value[1].get<float>(), value[2].get<float>() };
+        }
+
+        glm::vec3 CatmullRom(const glm::vec3& p0, const glm::vec3& p1, const glm::vec3& p2, const glm::vec3& p3, float t) {
+            float t2 = t * t;
+            float t3 = t2 * t;
+            return 0.5f * ((2.0f * p1) + (-p0 + p2) * t + (2.0f * p0 - 5.0f * p1 + 4.0f * p2 - p3) * t2 + (-p0 + 3.0f * p1 - 3.0f * p2 + p3) * t3);
+        }
+
+        uint64_t GetPeakResidentBytes() {
+#ifdef _WIN32
+            PROCESS_MEMORY_COUNTERS counters = {};
+            if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+                return counters.PeakWorkingSetSize;
+            }
+            return 0;
+#else
+            rusage usage = {};
+            if (getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+    #ifdef __APPLE__
+            return static_cast<uint64_t>(usage.ru_maxrss);        // Bytes
+    #else
+            return static_cast<uint64_t>(usage.ru_maxrss) * 1024; // Kilobytes
+    #endif
+#endif
+        }
+    }
+
+    const CameraSpline::Key& CameraSpline::GetKey(int index) const {
+        int count = static_cast<int>(m_Keys.size());
+        if (m_Loop) {
+            return m_Keys[((index % count) + count) % count];
+        }
+        return m_Keys[std::clamp(index, 0, count - 1)];
+    }
+
+    CameraSpline::Key CameraSpline::Evaluate(float t) const {
+        if (m_Keys.empty()) return {};
+        if (m_Keys.size() == 1) return m_Keys[0];
+
+        int segments = static_cast<int>(m_Keys.size()) - (m_Loop ? 0 : 1);
+        float u = std::clamp(t, 0.0f, 1.0f) * segments;
+        int segment = std::min(static_cast<int>(u), segments - 1);
+        float f = u - segment;
+
+        const Key& k0 = GetKey(segment - 1);
+        const Key& k1 = GetKey(segment);
+        const Key& k2 = GetKey(segment + 1);
+        const Key& k3 = GetKey(segment + 2);
+        return {
+            CatmullRom(k0.position, k1.position, k2.position, k3.position, f),
+            CatmullRom(k0.rotation, k1.rotation, k2.rotation, k3.rotation, f)
+        };
+    }
+
+    bool BenchmarkScenario::Load(const std::string& path, BenchmarkScenario& scenario) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_CORE_ERROR("Benchmark: could not open scenario {}", path);
+            return false;
+        }
+
+        try {
+            json root;
+            file >> root;
+
+            scenario.Name = root.value("name", std::filesystem::path(path).stem().string());
+            scenario.Frames = root.value("frames", scenario.Frames);
+            scenario.WarmupFrames = root.value("warmupFrames", scenario.WarmupFrames);
+            scenario.TickRate = root.value("tickRate", scenario.TickRate);
+            scenario.Seed = root.value("seed", scenario.Seed);
+            scenario.DebugDraw = root.value("debugDraw", scenario.DebugDraw);
+
+            if (root.contains("camera")) {
+                const json& camera = root["camera"];
+                scenario.Fov = camera.value("fov", scenario.Fov);
+                scenario.Camera.SetLoop(camera.value("loop", false));
+                if (camera.contains("keys")) {
+                    for (const json& key : camera["keys"]) {
+                        scenario.Camera.AddKey({ ReadVec3(key.value("position", json()), glm::vec3(0.0f)), ReadVec3(key.value("rotation", json()), glm::vec3(0.0f)) });
+                    }
+                }
+            }
+
+            scenario.Spawn.Seed = scenario.Seed;
+            if (root.contains("spawn")) {
+                const json& spawn = root["spawn"];
+                bool loaded = spawn.is_string()
+                    ? StressSceneSettings::Load(spawn.get<std::string>(), scenario.Spawn)
+                    : StressSceneSettings::FromJson(spawn, scenario.Spawn);
+                if (!loaded) return false;
+            }
+        } catch (const std::exception& e) {
+            LOG_CORE_ERROR("Benchmark: failed to parse scenario {}: {}", path, e.what());
+            return false;
+        }
+
+        if (scenario.Frames == 0) {
+            LOG_CORE_ERROR("Benchmark: scenario {} measures no frames", path);
+            return false;
+        }
+        if (scenario.Frames > Telemetry::Capacity) {
+            LOG_CORE_WARN("Benchmark: scenario {} measures {} frames, the report only covers the last {}",
+                path, scenario.Frames, Telemetry::Capacity);
+        }
+        if (scenario.Camera.IsEmpty()) {
+            LOG_CORE_WARN("Benchmark: scenario {} has no camera keys, the camera stays at the origin", path);
+        }
+        return true;
+    }
+
+    bool WriteBenchmarkReport(const std::string& path, const BenchmarkScenario& scenario, const BenchmarkRun& run) {
+        std::filesystem::path csvPath(path);
+        csvPath.replace_extension(".csv");
+        if (csvPath == std::filesystem::path(path)) {
+            csvPath += ".frames.csv";
+        }
+
+        json report = Telemetry::ToJson();
+        report["scenario"] = {
+            {"name", scenario.Name}, {"frames", scenario.Frames}, {"warmupFrames", scenario.WarmupFrames},
+            {"tickRate", scenario.TickRate}, {"seed", scenario.Seed},
+            {"spawn", {
+                {"seed", scenario.Spawn.Seed}, {"meshInstances", scenario.Spawn.MeshInstances},
+                {"uniqueMeshes", scenario.Spawn.MeshPaths.empty() ? scenario.Spawn.UniqueMeshes : static_cast<uint32_t>(scenario.Spawn.MeshPaths.size())},
+                {"pointLights", scenario.Spawn.PointLights}, {"characters", scenario.Spawn.Characters},
+                {"rigidBodies", scenario.Spawn.RigidBodies}
+            }}
+        };
+        report["run"] = {
+            {"driver", run.Driver}, {"headless", run.Headless}, {"pipelined", run.Pipelined}, {"threads", run.Threads},
+#ifdef NDEBUG
+            {"config", "Release"}
+#else
+            {"config", "Debug"}
+#endif
+        };
+        report["peakResidentBytes"] = GetPeakResidentBytes();
+
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            LOG_CORE_ERROR("Benchmark: could not open {}", path);
+            return false;
+        }
+        file << report.dump(4);
+
+        Telemetry::Summary frame = Telemetry::Summarize();
+        LOG_CORE_INFO("Benchmark '{}': {} frames | p50 {:.2f} ms | p95 {:.2f} ms | p99 {:.2f} ms -> {}",
+            scenario.Name, Telemetry::GetFrameCount(), frame.P50, frame.P95, frame.P99, path);
+
+        return Telemetry::WriteCsv(csvPath.string());
+    }
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include "../Scene/StressScene.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Core {
+
+    // Camera path through a list of keys (Catmull-Rom, uniform speed per segment).
+    // Rotations are pitch, yaw and roll in degrees (see CameraRotation) and are interpolated as-is,
+    // so author them without wrap-around.
+    class CameraSpline {
+    public:
+        struct Key {
+            glm::vec3 position = glm::vec3(0.0f);
+            glm::vec3 rotation = glm::vec3(0.0f);
+        };
+
+        void AddKey(const Key& key) { m_Keys.push_back(key); }
+        void SetLoop(bool loop) { m_Loop = loop; }
+        bool IsEmpty() const { return m_Keys.empty(); }
+
+        // t in [0, 1] covers the whole path (back to the first key when looping)
+        Key Evaluate(float t) const;
+
+    private:
+        const Key& GetKey(int index) const;
+
+        std::vector<Key> m_Keys;
+        bool m_Loop = false;
+    };
+
+    // A repeatable run for `--benchmark`: the camera flies along the spline over Frames measured
+    // frames, after WarmupFrames that are simulated but not recorded. Every frame advances exactly
+    // one fixed tick, so a scenario always simulates the same thing regardless of frame rate.
+    struct BenchmarkScenario {
+        std::string Name;
+        uint32_t Frames = 1000;
+        uint32_t WarmupFrames = 60;
+        double TickRate = 60.0;
+        uint32_t Seed = 1;
+        bool DebugDraw = false; // Collider and skeleton lines
+
+        float Fov = 60.0f;
+        CameraSpline Camera;
+
+        // Extra load generated on top of whatever the game module created. "spawn" is either the
+        // settings inline or the path of a stress settings file; it is seeded with Seed unless it sets its own.
+        StressSceneSettings Spawn;
+
+        // Returns false (and logs why) when the file is missing or malformed
+        static bool Load(const std::string& path, BenchmarkScenario& scenario);
+    };
+
+    // What a report records about the run besides the telemetry
+    struct BenchmarkRun {
+        std::string Driver;
+        bool Headless = false;
+        bool Pipelined = false;
+        uint32_t Threads = 0;
+    };
+
+    // Telemetry summary of the measured frames plus run details and peak process memory (JSON),
+    // and the per-frame telemetry next to it with a .csv extension
+    bool WriteBenchmarkReport(const std::string& path, const BenchmarkScenario& scenario, const BenchmarkRun& run);
+
+}
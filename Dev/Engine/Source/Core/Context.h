@@ -6,12 +6,14 @@ namespace flecs {
 
 namespace Core {
     class EventBus;
+    class JobSystem;
     // Forward declare AssetManager when we have it
     // class AssetManager; 
 
     struct GameContext {
         flecs::world* World = nullptr;
         EventBus* Events = nullptr;
+        JobSystem* Jobs = nullptr;
         // AssetManager* Assets = nullptr;
     };
 }
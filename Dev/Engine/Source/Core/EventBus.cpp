@@ -0,0 +1,71 @@
+#include "EventBus.h"
+#include <atomic>
+
+namespace Core {
+
+    namespace {
+        std::atomic<uint64_t> s_NextBusSerial{1};
+
+        // Last queue this thread used; almost always the one bus there is
+        struct CachedThreadQueue {
+            const void* bus = nullptr;
+            uint64_t serial = 0;
+            void* queue = nullptr;
+        };
+        thread_local CachedThreadQueue t_CachedQueue;
+    }
+
+    EventBus::EventBus() : m_Serial(s_NextBusSerial.fetch_add(1)) {}
+
+    EventBus::~EventBus() = default;
+
+    void EventBus::Unsubscribe(EventSubscription& subscription) {
+        if (!subscription.IsValid()) return;
+
+        auto it = m_Dispatchers.find(subscription.Type);
+        if (it != m_Dispatchers.end()) {
+            it->second->Remove(subscription.Id);
+        }
+        subscription = {};
+    }
+
+    void EventBus::DispatchQueued() {
+        // Gather every thread's events first, so each type is delivered as one batch.
+        // Threads are drained in the order they first enqueued, keeping per-thread order.
+        for (auto& threadQueue : m_ThreadQueues) {
+            for (auto& [type, queue] : threadQueue->queues) {
+                queue->MoveTo(*this);
+            }
+        }
+
+        for (IEventDispatcher* dispatcher : m_DispatchOrder) {
+            dispatcher->DispatchPending();
+        }
+    }
+
+    EventBus::ThreadQueue& EventBus::GetThreadQueue() {
+        CachedThreadQueue& cached = t_CachedQueue;
+        if (cached.bus == this && cached.serial == m_Serial) {
+            return *static_cast<ThreadQueue*>(cached.queue);
+        }
+
+        std::lock_guard<std::mutex> lock(m_ThreadQueueLock);
+        std::thread::id self = std::this_thread::get_id();
+        ThreadQueue* queue = nullptr;
+        for (auto& threadQueue : m_ThreadQueues) {
+            if (threadQueue->owner == self) {
+                queue = threadQueue.get();
+                break;
+            }
+        }
+        if (!queue) {
+            m_ThreadQueues.push_back(std::make_unique<ThreadQueue>());
+            queue = m_ThreadQueues.back().get();
+            queue->owner = self;
+        }
+
+        cached = { this, m_Serial, queue };
+        return *queue;
+    }
+
+}
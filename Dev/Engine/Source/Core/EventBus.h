@@ -1,57 +1,198 @@
 #pragma once
 
+#include "TypeId.h"
 #include <functional>
 #include <vector>
 #include <unordered_map>
-#include <typeindex>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <thread>
 #include <algorithm>
 
 namespace Core {
 
+    // Returned by Subscribe, pass to Unsubscribe. Default-constructed handles are invalid.
+    struct EventSubscription {
+        HashValue Type = 0;
+        uint32_t Id = 0;
+
+        bool IsValid() const { return Id != 0; }
+    };
+
+    // Events come in two flavours:
+    // - Publish() calls every subscriber immediately, on the calling thread (main thread only).
+    // - Enqueue() may be called from any thread. Events go into a queue owned by the calling thread,
+    //   so producers never contend, and are delivered in per-type batches by DispatchQueued().
+    //   The engine dispatches after every fixed tick; events enqueued while dispatching wait for the next one.
+    // Subscribe, Unsubscribe, Publish and DispatchQueued must not run while other threads are enqueuing.
     class EventBus {
     public:
         template<typename EventType>
         using Callback = std::function<void(const EventType&)>;
 
+        // Called once per dispatch with every queued event of the type (a single event for Publish)
         template<typename EventType>
-        void Subscribe(Callback<EventType> callback) {
-            auto typeIdx = std::type_index(typeid(EventType));
-            if (m_Subscribers.find(typeIdx) == m_Subscribers.end()) {
-                m_Subscribers[typeIdx] = std::make_unique<EventDispatcher<EventType>>();
-            }
-            static_cast<EventDispatcher<EventType>*>(m_Subscribers[typeIdx].get())->Add(callback);
+        using BatchCallback = std::function<void(std::span<const EventType>)>;
+
+        EventBus();
+        ~EventBus();
+
+        EventBus(const EventBus&) = delete;
+        EventBus& operator=(const EventBus&) = delete;
+
+        template<typename EventType>
+        EventSubscription Subscribe(Callback<EventType> callback) {
+            return GetDispatcher<EventType>().Add(++m_NextSubscriptionId, std::move(callback), nullptr);
+        }
+
+        template<typename EventType>
+        EventSubscription SubscribeBatch(BatchCallback<EventType> callback) {
+            return GetDispatcher<EventType>().Add(++m_NextSubscriptionId, nullptr, std::move(callback));
         }
 
+        // Safe to call from inside a callback, including for the subscription being dispatched.
+        // Subscribing from inside a callback is not. Resets the handle.
+        void Unsubscribe(EventSubscription& subscription);
+
         template<typename EventType>
         void Publish(const EventType& event) {
-            auto typeIdx = std::type_index(typeid(EventType));
-            if (m_Subscribers.find(typeIdx) != m_Subscribers.end()) {
-                static_cast<EventDispatcher<EventType>*>(m_Subscribers[typeIdx].get())->Dispatch(event);
+            if (auto* dispatcher = FindDispatcher<EventType>()) {
+                dispatcher->Dispatch(std::span<const EventType>(&event, 1));
             }
         }
 
+        template<typename EventType>
+        void Enqueue(EventType event) {
+            GetThreadQueue().Get<EventType>().events.push_back(std::move(event));
+        }
+
+        // Delivers everything enqueued since the last call, one event type at a time
+        void DispatchQueued();
+
     private:
         struct IEventDispatcher {
             virtual ~IEventDispatcher() = default;
+            virtual void Remove(uint32_t id) = 0;
+            virtual void DispatchPending() = 0;
         };
 
         template<typename EventType>
         struct EventDispatcher : IEventDispatcher {
-            std::vector<Callback<EventType>> callbacks;
+            struct Subscriber {
+                uint32_t id;
+                Callback<EventType> callback;
+                BatchCallback<EventType> batchCallback;
+            };
+            std::vector<Subscriber> subscribers;
+            std::vector<EventType> pending;     // Gathered from the thread queues
+            std::vector<EventType> dispatching; // Swapped with pending while callbacks run
+            uint32_t dispatchDepth = 0;
+            bool hasRemoved = false;
+
+            EventSubscription Add(uint32_t id, Callback<EventType> callback, BatchCallback<EventType> batchCallback) {
+                subscribers.push_back({ id, std::move(callback), std::move(batchCallback) });
+                return { TypeIdOf<EventType>, id };
+            }
+
+            void Remove(uint32_t id) override {
+                auto it = std::find_if(subscribers.begin(), subscribers.end(), [id](const Subscriber& s) { return s.id == id; });
+                if (it == subscribers.end()) return;
+                if (dispatchDepth > 0) {
+                    // Compacted once the dispatch unwinds
+                    it->id = 0;
+                    hasRemoved = true;
+                } else {
+                    subscribers.erase(it);
+                }
+            }
+
+            void Dispatch(std::span<const EventType> events) {
+                dispatchDepth++;
+                for (size_t i = 0; i < subscribers.size(); ++i) {
+                    if (subscribers[i].id == 0) continue;
+                    if (subscribers[i].batchCallback) {
+                        subscribers[i].batchCallback(events);
+                        continue;
+                    }
+                    for (const EventType& event : events) {
+                        if (subscribers[i].id == 0) break;
+                        subscribers[i].callback(event);
+                    }
+                }
+                if (--dispatchDepth == 0 && hasRemoved) {
+                    std::erase_if(subscribers, [](const Subscriber& s) { return s.id == 0; });
+                    hasRemoved = false;
+                }
+            }
+
+            void DispatchPending() override {
+                if (pending.empty()) return;
+                dispatching.swap(pending);
+                Dispatch(std::span<const EventType>(dispatching));
+                dispatching.clear();
+            }
+        };
 
-            void Add(Callback<EventType> callback) {
-                callbacks.push_back(callback);
+        // One per producing thread; only its owner appends, DispatchQueued drains
+        struct IEventQueue {
+            virtual ~IEventQueue() = default;
+            virtual void MoveTo(EventBus& bus) = 0;
+        };
+
+        template<typename EventType>
+        struct EventQueue : IEventQueue {
+            std::vector<EventType> events;
+
+            void MoveTo(EventBus& bus) override {
+                if (events.empty()) return;
+                if (auto* dispatcher = bus.FindDispatcher<EventType>()) {
+                    dispatcher->pending.insert(dispatcher->pending.end(),
+                        std::make_move_iterator(events.begin()), std::make_move_iterator(events.end()));
+                }
+                events.clear();
             }
+        };
+
+        struct ThreadQueue {
+            std::thread::id owner;
+            std::unordered_map<HashValue, std::unique_ptr<IEventQueue>> queues;
 
-            void Dispatch(const EventType& event) {
-                for (auto& callback : callbacks) {
-                    callback(event);
+            template<typename EventType>
+            EventQueue<EventType>& Get() {
+                auto& queue = queues[TypeIdOf<EventType>];
+                if (!queue) {
+                    queue = std::make_unique<EventQueue<EventType>>();
                 }
+                return *static_cast<EventQueue<EventType>*>(queue.get());
             }
         };
 
-        std::unordered_map<std::type_index, std::unique_ptr<IEventDispatcher>> m_Subscribers;
+        template<typename EventType>
+        EventDispatcher<EventType>* FindDispatcher() {
+            auto it = m_Dispatchers.find(TypeIdOf<EventType>);
+            return it != m_Dispatchers.end() ? static_cast<EventDispatcher<EventType>*>(it->second.get()) : nullptr;
+        }
+
+        template<typename EventType>
+        EventDispatcher<EventType>& GetDispatcher() {
+            auto& dispatcher = m_Dispatchers[TypeIdOf<EventType>];
+            if (!dispatcher) {
+                dispatcher = std::make_unique<EventDispatcher<EventType>>();
+                m_DispatchOrder.push_back(dispatcher.get());
+            }
+            return *static_cast<EventDispatcher<EventType>*>(dispatcher.get());
+        }
+
+        ThreadQueue& GetThreadQueue();
+
+        std::unordered_map<HashValue, std::unique_ptr<IEventDispatcher>> m_Dispatchers;
+        std::vector<IEventDispatcher*> m_DispatchOrder; // First-subscribed first, so batches run in a stable order
+        uint32_t m_NextSubscriptionId = 0;
+
+        std::mutex m_ThreadQueueLock; // Only taken the first time a thread enqueues
+        std::vector<std::unique_ptr<ThreadQueue>> m_ThreadQueues;
+        uint64_t m_Serial; // Tells thread-local caches apart from a previous bus at the same address
     };
 
 } // namespace Core
@@ -0,0 +1,36 @@
+#include "FlecsProfiler.h"
+#include "Profiler.h"
+
+namespace Core {
+
+    void FlecsProfiler::Sample(flecs::world& world) {
+#ifdef TRACY_ENABLE
+        if (m_World != world.c_ptr()) {
+            m_World = world.c_ptr();
+            m_Systems.clear();
+            ecs_measure_system_time(m_World, true);
+        }
+
+        world.each(flecs::System, [this](flecs::entity system) {
+            const ecs_system_t* data = ecs_system_get(m_World, system.id());
+            if (!data) return;
+
+            auto [it, inserted] = m_Systems.try_emplace(system.id());
+            SystemEntry& entry = it->second;
+            if (inserted) {
+                entry.PlotName = std::string("ECS/") + system.name().c_str();
+                entry.LastTimeSpent = static_cast<float>(data->time_spent);
+                return;
+            }
+
+            // time_spent accumulates seconds since the system was created
+            float spent = static_cast<float>(data->time_spent);
+            PROFILE_PLOT(entry.PlotName.c_str(), static_cast<double>(spent - entry.LastTimeSpent) * 1000.0);
+            entry.LastTimeSpent = spent;
+        });
+#else
+        (void)world;
+#endif
+    }
+
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <flecs.h>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+namespace Core {
+
+    // Plots the time every flecs system spent since the last sample as a Tracy series ("ECS/<name>"),
+    // so ECS time can be attributed to systems that only show up inside a scheduler or pipeline zone.
+    // Turns on flecs' per-system timing on first use. Does nothing unless Tracy is enabled.
+    class FlecsProfiler {
+    public:
+        // Call once per tick from the thread that owns the world, outside readonly mode
+        void Sample(flecs::world& world);
+
+    private:
+        struct SystemEntry {
+            std::string PlotName; // Tracy keeps the pointer
+            float LastTimeSpent = 0.0f;
+        };
+
+        ecs_world_t* m_World = nullptr;
+        std::unordered_map<uint64_t, SystemEntry> m_Systems;
+    };
+
+}
@@ -0,0 +1,115 @@
+#include "FrameAllocator.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+
+namespace Core {
+
+    namespace {
+        struct Block {
+            std::unique_ptr<std::byte[]> Memory;
+            size_t Size = 0;
+        };
+
+        struct Arena {
+            std::vector<Block> Blocks;
+            size_t Current = 0; // Block being bumped
+            size_t Offset = 0;  // Into the current block
+            size_t Used = 0;    // Bytes handed out since the last reset
+
+            Arena();
+            ~Arena();
+        };
+
+        std::mutex s_ArenaLock; // Guards s_Arenas and s_LastFrameBytes
+        std::vector<Arena*> s_Arenas;
+        size_t s_LastFrameBytes = 0;
+        std::atomic<uint64_t> s_BlockAllocations{0};
+
+        Arena::Arena() {
+            std::lock_guard<std::mutex> lock(s_ArenaLock);
+            s_Arenas.push_back(this);
+        }
+
+        Arena::~Arena() {
+#ifdef TRACY_ENABLE
+            for (const Block& block : Blocks) {
+                PROFILE_FREE(block.Memory.get(), "FrameAllocator");
+            }
+#endif
+            std::lock_guard<std::mutex> lock(s_ArenaLock);
+            s_Arenas.erase(std::remove(s_Arenas.begin(), s_Arenas.end(), this), s_Arenas.end());
+        }
+
+        thread_local Arena t_Arena;
+
+        size_t AlignUp(size_t value, size_t alignment) {
+            return (value + alignment - 1) & ~(alignment - 1);
+        }
+    }
+
+    void* FrameAllocator::Allocate(size_t size, size_t alignment) {
+        Arena& arena = t_Arena;
+        size = std::max<size_t>(size, 1);
+
+        if (arena.Current < arena.Blocks.size()) {
+            Block& block = arena.Blocks[arena.Current];
+            size_t offset = AlignUp(arena.Offset, alignment);
+            if (offset + size <= block.Size) {
+                arena.Offset = offset + size;
+                arena.Used += size;
+                return block.Memory.get() + offset;
+            }
+        }
+
+        // Move on to a later block that fits, or grow. Block starts are max_align_t aligned.
+        size_t needed = size + (alignment > alignof(std::max_align_t) ? alignment : 0);
+        size_t next = arena.Blocks.empty() ? 0 : arena.Current + 1;
+        while (next < arena.Blocks.size() && arena.Blocks[next].Size < needed) {
+            next++;
+        }
+        if (next == arena.Blocks.size()) {
+            Block block;
+            block.Size = std::max(BlockSize, needed);
+            block.Memory = std::make_unique<std::byte[]>(block.Size);
+            PROFILE_ALLOC(block.Memory.get(), block.Size, "FrameAllocator");
+            arena.Blocks.push_back(std::move(block));
+            s_BlockAllocations.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        Block& block = arena.Blocks[next];
+        size_t offset = AlignUp(reinterpret_cast<uintptr_t>(block.Memory.get()), alignment) - reinterpret_cast<uintptr_t>(block.Memory.get());
+        arena.Current = next;
+        arena.Offset = offset + size;
+        arena.Used += size;
+        return block.Memory.get() + offset;
+    }
+
+    void FrameAllocator::ResetAll() {
+        std::lock_guard<std::mutex> lock(s_ArenaLock);
+        s_LastFrameBytes = 0;
+        for (Arena* arena : s_Arenas) {
+            s_LastFrameBytes += arena->Used;
+            arena->Current = 0;
+            arena->Offset = 0;
+            arena->Used = 0;
+        }
+    }
+
+    FrameAllocator::Stats FrameAllocator::GetStats() {
+        std::lock_guard<std::mutex> lock(s_ArenaLock);
+        Stats stats;
+        stats.BytesUsed = s_LastFrameBytes;
+        stats.Arenas = static_cast<uint32_t>(s_Arenas.size());
+        stats.BlockAllocations = s_BlockAllocations.load(std::memory_order_relaxed);
+        for (const Arena* arena : s_Arenas) {
+            for (const Block& block : arena->Blocks) {
+                stats.BytesReserved += block.Size;
+            }
+        }
+        return stats;
+    }
+
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <vector>
+
+namespace Core {
+
+    // Linear arenas for data that only lives for one frame. Every thread bumps its own arena,
+    // so allocating never takes a lock; Engine::Step rewinds all of them at the start of a frame.
+    // Blocks are kept across resets, so once the arenas have grown to a frame's peak usage
+    // allocating from them never touches the general heap again.
+    class FrameAllocator {
+    public:
+        static constexpr size_t BlockSize = 1 << 20;
+
+        struct Stats {
+            size_t BytesUsed = 0;      // Handed out during the last completed frame, all threads
+            size_t BytesReserved = 0;  // Held by all arenas
+            uint32_t Arenas = 0;       // Threads that have allocated
+            uint64_t BlockAllocations = 0; // Heap allocations made by the arenas since startup
+        };
+
+        // Memory is valid until the next ResetAll(). Never returns nullptr.
+        static void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+        template<typename T>
+        static T* AllocateArray(size_t count) {
+            return static_cast<T*>(Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        // Rewinds every thread's arena. Only call while no other thread is using frame memory.
+        static void ResetAll();
+
+        // Same rule as ResetAll(): the arenas must be idle
+        static Stats GetStats();
+    };
+
+    // STL adapter. Deallocation is a no-op; the memory comes back when the frame ends.
+    template<typename T>
+    class FrameStdAllocator {
+    public:
+        using value_type = T;
+
+        FrameStdAllocator() noexcept = default;
+        template<typename U>
+        FrameStdAllocator(const FrameStdAllocator<U>&) noexcept {}
+
+        T* allocate(size_t count) { return FrameAllocator::AllocateArray<T>(count); }
+        void deallocate(T*, size_t) noexcept {}
+
+        template<typename U>
+        bool operator==(const FrameStdAllocator<U>&) const noexcept { return true; }
+    };
+
+    // Must not outlive the frame it was filled in
+    template<typename T>
+    using FrameVector = std::vector<T, FrameStdAllocator<T>>;
+
+}
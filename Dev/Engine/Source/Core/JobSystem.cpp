@@ -0,0 +1,297 @@
+#include "JobSystem.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <algorithm>
+#include <string>
+
+namespace Core {
+
+    namespace {
+        // Which JobSystem (if any) owns the current thread, and the thread's index in it
+        thread_local const JobSystem* t_Owner = nullptr;
+        thread_local uint32_t t_ThreadIndex = JobSystem::InvalidThreadIndex;
+
+        constexpr uint32_t SpinsBeforeSleep = 64;
+    }
+
+    bool JobSystem::WorkQueue::Push(Job* job) {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (Tail - Head >= QueueCapacity) {
+            return false;
+        }
+        Jobs[Tail % QueueCapacity] = job;
+        ++Tail;
+        return true;
+    }
+
+    Job* JobSystem::WorkQueue::Pop() {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (Tail == Head) {
+            return nullptr;
+        }
+        --Tail;
+        return Jobs[Tail % QueueCapacity];
+    }
+
+    Job* JobSystem::WorkQueue::Steal() {
+        std::lock_guard<std::mutex> lock(Lock);
+        if (Tail == Head) {
+            return nullptr;
+        }
+        Job* job = Jobs[Head % QueueCapacity];
+        ++Head;
+        return job;
+    }
+
+    JobSystem::JobSystem() = default;
+
+    JobSystem::~JobSystem() {
+        Shutdown();
+
+        while (m_FreeJobs) {
+            Job* next = m_FreeJobs->Next;
+            delete m_FreeJobs;
+            m_FreeJobs = next;
+        }
+    }
+
+    void JobSystem::Init(uint32_t workerCount) {
+        if (m_Running.load()) {
+            LOG_CORE_WARN("JobSystem already initialized");
+            return;
+        }
+
+        if (workerCount == 0) {
+            uint32_t hardwareThreads = std::thread::hardware_concurrency();
+            workerCount = hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+        }
+
+        m_ThreadCount = workerCount + 1;
+        m_Queues = std::make_unique<WorkQueue[]>(m_ThreadCount);
+        for (uint32_t i = 0; i < m_ThreadCount; ++i) {
+            m_Queues[i].Jobs = std::make_unique<Job*[]>(QueueCapacity);
+        }
+        m_Injection.Jobs = std::make_unique<Job*[]>(QueueCapacity);
+
+        t_Owner = this;
+        t_ThreadIndex = 0;
+
+        m_Running.store(true);
+        m_Workers.reserve(workerCount);
+        for (uint32_t i = 1; i <= workerCount; ++i) {
+            m_Workers.emplace_back([this, i]() { WorkerLoop(i); });
+        }
+
+        LOG_CORE_INFO("JobSystem initialized with {} worker threads", workerCount);
+    }
+
+    void JobSystem::Shutdown() {
+        if (!m_Running.exchange(false)) {
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+        }
+        m_WakeCondition.notify_all();
+
+        for (auto& worker : m_Workers) {
+            worker.join();
+        }
+        m_Workers.clear();
+
+        // Drain anything that was queued after the last Wait()
+        while (Job* job = FindJob(0)) {
+            Run(job);
+        }
+        m_ThreadCount = 0;
+
+        if (t_Owner == this) {
+            t_Owner = nullptr;
+            t_ThreadIndex = InvalidThreadIndex;
+        }
+    }
+
+    uint32_t JobSystem::GetThreadIndex() const {
+        return t_Owner == this ? t_ThreadIndex : InvalidThreadIndex;
+    }
+
+    Job* JobSystem::AllocateJob() {
+        {
+            std::lock_guard<std::mutex> lock(m_FreeLock);
+            if (m_FreeJobs) {
+                Job* job = m_FreeJobs;
+                m_FreeJobs = job->Next;
+                return job;
+            }
+        }
+        return new Job();
+    }
+
+    void JobSystem::FreeJob(Job* job) {
+        std::lock_guard<std::mutex> lock(m_FreeLock);
+        job->Next = m_FreeJobs;
+        m_FreeJobs = job;
+    }
+
+    void JobSystem::Submit(Job* job) {
+        if (!m_Running.load(std::memory_order_acquire)) {
+            // No workers to hand it to; run synchronously
+            Run(job);
+            return;
+        }
+
+        uint32_t threadIndex = GetThreadIndex();
+        WorkQueue& queue = threadIndex != InvalidThreadIndex ? m_Queues[threadIndex] : m_Injection;
+
+        m_PendingJobs.fetch_add(1);
+        if (!queue.Push(job)) {
+            // Queue is full, executing inline keeps us making progress
+            m_PendingJobs.fetch_sub(1);
+            Run(job);
+            return;
+        }
+
+        if (m_SleepingWorkers.load() > 0) {
+            {
+                std::lock_guard<std::mutex> lock(m_WakeMutex);
+            }
+            m_WakeCondition.notify_one();
+        }
+    }
+
+    void JobSystem::Run(Job* job) {
+        job->Invoke(job->Storage);
+        job->Destroy(job->Storage);
+
+        JobCounter* counter = job->Counter;
+        FreeJob(job);
+
+        if (!counter) {
+            return;
+        }
+
+        // Decrement under the lock so Wait() can't return (and the counter go out of scope)
+        // while we are still touching it
+        Job* continuations = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(counter->m_Lock);
+            if (counter->m_Value.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                continuations = counter->m_Continuations;
+                counter->m_Continuations = nullptr;
+            }
+        }
+
+        while (continuations) {
+            Job* next = continuations->Next;
+            continuations->Next = nullptr;
+            Submit(continuations);
+            continuations = next;
+        }
+    }
+
+    Job* JobSystem::FindJob(uint32_t threadIndex) {
+        if (!m_Queues) {
+            return nullptr;
+        }
+
+        if (threadIndex != InvalidThreadIndex) {
+            if (Job* job = m_Queues[threadIndex].Pop()) {
+                m_PendingJobs.fetch_sub(1);
+                return job;
+            }
+        }
+
+        if (Job* job = m_Injection.Steal()) {
+            m_PendingJobs.fetch_sub(1);
+            return job;
+        }
+
+        uint32_t threadCount = GetThreadCount();
+        uint32_t start = threadIndex != InvalidThreadIndex ? threadIndex + 1 : 0;
+        for (uint32_t i = 0; i < threadCount; ++i) {
+            uint32_t victim = (start + i) % threadCount;
+            if (victim == threadIndex) {
+                continue;
+            }
+            if (Job* job = m_Queues[victim].Steal()) {
+                m_PendingJobs.fetch_sub(1);
+                return job;
+            }
+        }
+
+        return nullptr;
+    }
+
+    void JobSystem::Wait(JobCounter& counter) {
+        uint32_t threadIndex = GetThreadIndex();
+
+        while (!counter.IsDone()) {
+            Job* job = threadIndex != InvalidThreadIndex ? FindJob(threadIndex) : nullptr;
+            if (job) {
+                Run(job);
+            } else {
+                std::this_thread::yield();
+            }
+        }
+
+        // Synchronize with the thread that performed the final decrement
+        std::lock_guard<std::mutex> lock(counter.m_Lock);
+    }
+
+    void JobSystem::ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func) {
+        if (count == 0) {
+            return;
+        }
+        batchSize = std::max(batchSize, 1u);
+
+        if (count <= batchSize || GetWorkerCount() == 0) {
+            func(0, count);
+            return;
+        }
+
+        JobCounter counter;
+        const auto* funcPtr = &func;
+        for (uint32_t begin = 0; begin < count; begin += batchSize) {
+            uint32_t end = std::min(begin + batchSize, count);
+            Execute([funcPtr, begin, end]() { (*funcPtr)(begin, end); }, &counter);
+        }
+        Wait(counter);
+    }
+
+    void JobSystem::WorkerLoop(uint32_t threadIndex) {
+        t_Owner = this;
+        t_ThreadIndex = threadIndex;
+
+#ifdef TRACY_ENABLE
+        std::string threadName = "Worker " + std::to_string(threadIndex);
+        tracy::SetThreadName(threadName.c_str());
+#endif
+
+        uint32_t idleSpins = 0;
+        while (m_Running.load(std::memory_order_acquire)) {
+            if (Job* job = FindJob(threadIndex)) {
+                Run(job);
+                idleSpins = 0;
+                continue;
+            }
+
+            if (++idleSpins < SpinsBeforeSleep) {
+                std::this_thread::yield();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> lock(m_WakeMutex);
+            m_SleepingWorkers.fetch_add(1);
+            m_WakeCondition.wait(lock, [this]() {
+                return m_PendingJobs.load() > 0 || !m_Running.load();
+            });
+            m_SleepingWorkers.fetch_sub(1);
+            idleSpins = 0;
+        }
+
+        t_Owner = nullptr;
+        t_ThreadIndex = InvalidThreadIndex;
+    }
+
+}
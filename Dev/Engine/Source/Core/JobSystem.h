@@ -0,0 +1,157 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Core {
+
+    class JobSystem;
+
+    // A unit of work. Callables are stored inline so scheduling never touches the heap
+    // once the job pool has warmed up.
+    struct Job {
+        static constexpr size_t StorageSize = 64;
+
+        void (*Invoke)(void* storage) = nullptr;
+        void (*Destroy)(void* storage) = nullptr;
+        class JobCounter* Counter = nullptr;
+        Job* Next = nullptr; // Free list / continuation list link
+        alignas(std::max_align_t) unsigned char Storage[StorageSize];
+    };
+
+    // Tracks outstanding jobs. A counter reaches zero once every job that was
+    // scheduled against it has finished; jobs scheduled with ExecuteAfter() run then.
+    class JobCounter {
+    public:
+        JobCounter() = default;
+        JobCounter(const JobCounter&) = delete;
+        JobCounter& operator=(const JobCounter&) = delete;
+
+        uint32_t GetValue() const { return m_Value.load(std::memory_order_acquire); }
+        bool IsDone() const { return GetValue() == 0; }
+
+    private:
+        friend class JobSystem;
+
+        std::atomic<uint32_t> m_Value{0};
+        std::mutex m_Lock;              // Guards m_Continuations
+        Job* m_Continuations = nullptr; // Jobs waiting for this counter to reach zero
+    };
+
+    // Shared worker pool for the whole engine. Each worker owns a work-stealing deque:
+    // it pops its own work LIFO (cache-warm) and steals FIFO from other workers when idle.
+    // The thread that calls Init() becomes thread 0 and helps execute jobs while it waits.
+    class JobSystem {
+    public:
+        static constexpr uint32_t InvalidThreadIndex = 0xFFFFFFFF;
+        static constexpr uint32_t QueueCapacity = 4096;
+
+        JobSystem();
+        ~JobSystem();
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        // workerCount == 0 picks hardware_concurrency - 1 (the calling thread is the extra one)
+        void Init(uint32_t workerCount = 0);
+        void Shutdown();
+
+        // Schedule a job. If counter is set it is incremented now and decremented when the job finishes.
+        template<typename Func>
+        void Execute(Func&& func, JobCounter* counter = nullptr) {
+            Submit(CreateJob(std::forward<Func>(func), counter));
+        }
+
+        // Schedule a job that only starts once `dependency` reaches zero
+        template<typename Func>
+        void ExecuteAfter(JobCounter& dependency, Func&& func, JobCounter* counter = nullptr) {
+            Job* job = CreateJob(std::forward<Func>(func), counter);
+            {
+                std::lock_guard<std::mutex> lock(dependency.m_Lock);
+                if (!dependency.IsDone()) {
+                    job->Next = dependency.m_Continuations;
+                    dependency.m_Continuations = job;
+                    return;
+                }
+            }
+            Submit(job);
+        }
+
+        // Block until the counter reaches zero. Threads owned by this system run other jobs meanwhile.
+        void Wait(JobCounter& counter);
+
+        // Split [0, count) into batches of batchSize and run func(begin, end) for each, then wait
+        void ParallelFor(uint32_t count, uint32_t batchSize, const std::function<void(uint32_t, uint32_t)>& func);
+
+        uint32_t GetWorkerCount() const { return m_ThreadCount > 0 ? m_ThreadCount - 1 : 0; }
+        // Workers plus the owning thread
+        uint32_t GetThreadCount() const { return m_ThreadCount; }
+        bool IsInitialized() const { return m_Running.load(std::memory_order_acquire); }
+
+        // 0 for the thread that called Init(), 1..N for workers, InvalidThreadIndex for any other thread
+        uint32_t GetThreadIndex() const;
+
+    private:
+        struct WorkQueue {
+            std::mutex Lock;
+            std::unique_ptr<Job*[]> Jobs;
+            uint32_t Head = 0; // Steal end
+            uint32_t Tail = 0; // Owner end
+
+            bool Push(Job* job);
+            Job* Pop();
+            Job* Steal();
+        };
+
+        template<typename Func>
+        Job* CreateJob(Func&& func, JobCounter* counter) {
+            using Callable = std::decay_t<Func>;
+            static_assert(sizeof(Callable) <= Job::StorageSize, "Job capture too large, capture by pointer instead");
+            static_assert(alignof(Callable) <= alignof(std::max_align_t), "Job capture over-aligned");
+
+            Job* job = AllocateJob();
+            new (job->Storage) Callable(std::forward<Func>(func));
+            job->Invoke = [](void* storage) { (*static_cast<Callable*>(storage))(); };
+            job->Destroy = [](void* storage) { static_cast<Callable*>(storage)->~Callable(); };
+            job->Counter = counter;
+            job->Next = nullptr;
+            if (counter) {
+                counter->m_Value.fetch_add(1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+
+        Job* AllocateJob();
+        void FreeJob(Job* job);
+
+        void Submit(Job* job);
+        void Run(Job* job);
+        Job* FindJob(uint32_t threadIndex);
+        void WorkerLoop(uint32_t threadIndex);
+
+        std::vector<std::thread> m_Workers;
+        uint32_t m_ThreadCount = 0;
+        std::unique_ptr<WorkQueue[]> m_Queues; // One per thread, index 0 is the owning thread
+        WorkQueue m_Injection;                  // Jobs submitted from threads not owned by this system
+
+        std::atomic<bool> m_Running{false};
+        std::atomic<uint32_t> m_PendingJobs{0};
+        std::atomic<uint32_t> m_SleepingWorkers{0};
+        std::mutex m_WakeMutex;
+        std::condition_variable m_WakeCondition;
+
+        std::mutex m_FreeLock;
+        Job* m_FreeJobs = nullptr;
+    };
+
+}
@@ -1,4 +1,5 @@
 #include "Log.h"
+#include <spdlog/async.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
 
 namespace Core {
@@ -6,14 +7,55 @@ namespace Core {
     std::shared_ptr<spdlog::logger> Log::s_CoreLogger;
     std::shared_ptr<spdlog::logger> Log::s_ClientLogger;
 
+    namespace {
+        constexpr size_t QueueSize = 8192; // Messages, shared by both loggers
+
+        std::shared_ptr<spdlog::logger> CreateLogger(const std::string& name, spdlog::sink_ptr sink, bool async) {
+            std::shared_ptr<spdlog::logger> logger;
+            if (async) {
+                // Block rather than drop when the ring is full; it only fills if the console can't keep up
+                logger = std::make_shared<spdlog::async_logger>(name, std::move(sink), spdlog::thread_pool(),
+                                                                spdlog::async_overflow_policy::block);
+            } else {
+                logger = std::make_shared<spdlog::logger>(name, std::move(sink));
+            }
+            logger->set_level(spdlog::level::trace);
+            logger->flush_on(spdlog::level::err);
+            spdlog::register_logger(logger);
+            return logger;
+        }
+    }
+
     void Log::Init() {
-        spdlog::set_pattern("%^[%T] %n: %v%$");
-        
-        s_CoreLogger = spdlog::stdout_color_mt("ENGINE");
-        s_CoreLogger->set_level(spdlog::level::trace);
+        if (s_CoreLogger) return;
+
+        spdlog::init_thread_pool(QueueSize, 1);
+
+        auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        sink->set_pattern("%^[%T] %n: %v%$");
+
+        s_CoreLogger = CreateLogger("ENGINE", sink, true);
+        s_ClientLogger = CreateLogger("APP", sink, true);
+    }
+
+    void Log::Shutdown() {
+        if (!s_CoreLogger) return;
+
+        s_CoreLogger->flush();
+        s_ClientLogger->flush();
+        auto coreLevel = s_CoreLogger->level();
+        auto clientLevel = s_ClientLogger->level();
+
+        // Joins the writer thread; drops the registry's references
+        spdlog::shutdown();
 
-        s_ClientLogger = spdlog::stdout_color_mt("APP");
-        s_ClientLogger->set_level(spdlog::level::trace);
+        // Static destructors and unloaded modules may still log
+        auto sink = std::make_shared<spdlog::sinks::stdout_color_sink_mt>();
+        sink->set_pattern("%^[%T] %n: %v%$");
+        s_CoreLogger = CreateLogger("ENGINE", sink, false);
+        s_ClientLogger = CreateLogger("APP", sink, false);
+        s_CoreLogger->set_level(coreLevel);
+        s_ClientLogger->set_level(clientLevel);
     }
 
 }
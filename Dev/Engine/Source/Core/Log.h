@@ -1,5 +1,11 @@
 #pragma once
 
+// Calls below this level compile away entirely (arguments are not evaluated).
+// CMake sets it from OAKEN_LOG_LEVEL; this covers translation units built without it.
+#ifndef SPDLOG_ACTIVE_LEVEL
+    #define SPDLOG_ACTIVE_LEVEL SPDLOG_LEVEL_TRACE
+#endif
+
 #include <spdlog/spdlog.h>
 #include <memory>
 
@@ -17,7 +23,11 @@ namespace Core {
 
     class OAKEN_API Log {
     public:
+        // Messages are formatted on the calling thread and written by a background thread,
+        // so logging from a system never waits on the console
         static void Init();
+        // Flushes anything still queued. Logging afterwards is synchronous.
+        static void Shutdown();
 
         static std::shared_ptr<spdlog::logger>& GetCoreLogger() { return s_CoreLogger; }
         static std::shared_ptr<spdlog::logger>& GetClientLogger() { return s_ClientLogger; }
@@ -30,15 +40,17 @@ namespace Core {
 }
 
 // Core log macros
-#define LOG_CORE_TRACE(...)    ::Core::Log::GetCoreLogger()->trace(__VA_ARGS__)
-#define LOG_CORE_INFO(...)     ::Core::Log::GetCoreLogger()->info(__VA_ARGS__)
-#define LOG_CORE_WARN(...)     ::Core::Log::GetCoreLogger()->warn(__VA_ARGS__)
-#define LOG_CORE_ERROR(...)    ::Core::Log::GetCoreLogger()->error(__VA_ARGS__)
-#define LOG_CORE_FATAL(...)    ::Core::Log::GetCoreLogger()->critical(__VA_ARGS__)
+#define LOG_CORE_TRACE(...)    SPDLOG_LOGGER_TRACE(::Core::Log::GetCoreLogger(), __VA_ARGS__)
+#define LOG_CORE_DEBUG(...)    SPDLOG_LOGGER_DEBUG(::Core::Log::GetCoreLogger(), __VA_ARGS__)
+#define LOG_CORE_INFO(...)     SPDLOG_LOGGER_INFO(::Core::Log::GetCoreLogger(), __VA_ARGS__)
+#define LOG_CORE_WARN(...)     SPDLOG_LOGGER_WARN(::Core::Log::GetCoreLogger(), __VA_ARGS__)
+#define LOG_CORE_ERROR(...)    SPDLOG_LOGGER_ERROR(::Core::Log::GetCoreLogger(), __VA_ARGS__)
+#define LOG_CORE_FATAL(...)    SPDLOG_LOGGER_CRITICAL(::Core::Log::GetCoreLogger(), __VA_ARGS__)
 
 // Client log macros
-#define LOG_TRACE(...)         ::Core::Log::GetClientLogger()->trace(__VA_ARGS__)
-#define LOG_INFO(...)          ::Core::Log::GetClientLogger()->info(__VA_ARGS__)
-#define LOG_WARN(...)          ::Core::Log::GetClientLogger()->warn(__VA_ARGS__)
-#define LOG_ERROR(...)         ::Core::Log::GetClientLogger()->error(__VA_ARGS__)
-#define LOG_FATAL(...)         ::Core::Log::GetClientLogger()->critical(__VA_ARGS__)
+#define LOG_TRACE(...)         SPDLOG_LOGGER_TRACE(::Core::Log::GetClientLogger(), __VA_ARGS__)
+#define LOG_DEBUG(...)         SPDLOG_LOGGER_DEBUG(::Core::Log::GetClientLogger(), __VA_ARGS__)
+#define LOG_INFO(...)          SPDLOG_LOGGER_INFO(::Core::Log::GetClientLogger(), __VA_ARGS__)
+#define LOG_WARN(...)          SPDLOG_LOGGER_WARN(::Core::Log::GetClientLogger(), __VA_ARGS__)
+#define LOG_ERROR(...)         SPDLOG_LOGGER_ERROR(::Core::Log::GetClientLogger(), __VA_ARGS__)
+#define LOG_FATAL(...)         SPDLOG_LOGGER_CRITICAL(::Core::Log::GetClientLogger(), __VA_ARGS__)
@@ -1,10 +1,23 @@
 #pragma once
 
 #include <tracy/Tracy.hpp>
+#include "Telemetry.h"
+
+#define OAKEN_PROFILE_CONCAT_INNER(a, b) a##b
+#define OAKEN_PROFILE_CONCAT(a, b) OAKEN_PROFILE_CONCAT_INNER(a, b)
 
 // Macros for easy usage
 #define PROFILE_FRAME(name) FrameMark
-#define PROFILE_SCOPE(name) ZoneScopedN(name)
+// Tracy zone, also timed into the telemetry phase of the same name
+#define PROFILE_SCOPE(name) \
+    ZoneScopedN(name); \
+    static const uint32_t OAKEN_PROFILE_CONCAT(s_TelemetryPhase, __LINE__) = ::Core::Telemetry::RegisterPhase(name); \
+    ::Core::TelemetryScope OAKEN_PROFILE_CONCAT(telemetryScope, __LINE__)(OAKEN_PROFILE_CONCAT(s_TelemetryPhase, __LINE__))
 #define PROFILE_FUNCTION() ZoneScoped
 
+// Tracy only: one sample of a numeric series (name must stay valid), and allocations in a named pool
+#define PROFILE_PLOT(name, value) TracyPlot(name, value)
+#define PROFILE_ALLOC(ptr, size, pool) TracyAllocN(ptr, size, pool)
+#define PROFILE_FREE(ptr, pool) TracyFreeN(ptr, pool)
+
 // We can add GPU profiling macros here later when we have the RenderDevice set up
@@ -0,0 +1,287 @@
+#include "SystemScheduler.h"
+#include "JobSystem.h"
+#include "Log.h"
+#include "Profiler.h"
+#include <flecs.h>
+#include <imgui.h>
+#include <spdlog/fmt/fmt.h>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Core {
+
+    namespace {
+        // Flecs task threads are backed by the engine job system so a multithreaded
+        // progress() doesn't spin up OS threads every frame.
+        JobSystem* s_TaskJobs = nullptr;
+
+        struct FlecsTask {
+            JobCounter Done;
+            ecs_os_thread_callback_t Callback = nullptr;
+            void* Param = nullptr;
+            void* Result = nullptr;
+        };
+
+        ecs_os_thread_t FlecsTaskNew(ecs_os_thread_callback_t callback, void* param) {
+            FlecsTask* task = new FlecsTask();
+            task->Callback = callback;
+            task->Param = param;
+            s_TaskJobs->Execute([task]() { task->Result = task->Callback(task->Param); }, &task->Done);
+            return static_cast<ecs_os_thread_t>(reinterpret_cast<uintptr_t>(task));
+        }
+
+        void* FlecsTaskJoin(ecs_os_thread_t thread) {
+            FlecsTask* task = reinterpret_cast<FlecsTask*>(static_cast<uintptr_t>(thread));
+            s_TaskJobs->Wait(task->Done);
+            void* result = task->Result;
+            delete task;
+            return result;
+        }
+
+        bool Overlaps(const std::vector<HashValue>& a, const std::vector<HashValue>& b) {
+            for (HashValue value : a) {
+                if (std::find(b.begin(), b.end(), value) != b.end()) {
+                    return true;
+                }
+            }
+            return false;
+        }
+    }
+
+    bool SystemAccess::ConflictsWith(const SystemAccess& other) const {
+        if (Exclusive || other.Exclusive) {
+            return true;
+        }
+        return Overlaps(Writes, other.Writes) || Overlaps(Writes, other.Reads) || Overlaps(Reads, other.Writes);
+    }
+
+    SystemScheduler::SystemScheduler() = default;
+    SystemScheduler::~SystemScheduler() = default;
+
+    void SystemScheduler::Init(flecs::world& world, JobSystem* jobs) {
+        m_World = &world;
+        m_Jobs = jobs;
+
+        if (m_Jobs && m_Jobs->IsInitialized() && m_Jobs->GetThreadCount() > 1) {
+            s_TaskJobs = m_Jobs;
+            ecs_os_api.task_new_ = FlecsTaskNew;
+            ecs_os_api.task_join_ = FlecsTaskJoin;
+
+            // One stage per job system thread, indexed by JobSystem::GetThreadIndex()
+            world.set_task_threads(static_cast<int32_t>(m_Jobs->GetThreadCount()));
+        }
+    }
+
+    void SystemScheduler::AddSystem(const std::string& name, const SystemAccess& access, SystemFunction function) {
+        Node node;
+        node.Name = name;
+        node.Access = access;
+        node.Function = std::move(function);
+        m_Nodes.push_back(std::move(node));
+        m_Dirty = true;
+    }
+
+    void SystemScheduler::AddSystem(const std::string& name, const SystemAccess& access, const flecs::system& system) {
+        flecs::entity_t id = system.id();
+        const ecs_system_t* desc = ecs_system_get(system.world().c_ptr(), id);
+
+        if (desc && desc->multi_threaded) {
+            AddSystem(name, access, [this, id](flecs::world&, float dt) {
+                RunWorkers(id, dt);
+            });
+            m_Nodes.back().Wide = true;
+            return;
+        }
+
+        AddSystem(name, access, [id](flecs::world& world, float dt) {
+            ecs_run(world.c_ptr(), id, dt, nullptr);
+        });
+    }
+
+    void SystemScheduler::Build() {
+        m_Segments.clear();
+
+        for (uint32_t i = 0; i < m_Nodes.size(); ++i) {
+            Node& node = m_Nodes[i];
+            node.Dependencies.clear();
+            node.Dependents.clear();
+            node.Level = 0;
+
+            bool alone = node.Access.Exclusive || node.Wide;
+            bool startSegment = m_Segments.empty() || alone || m_Segments.back().Exclusive;
+            if (startSegment) {
+                m_Segments.push_back({ i, 0, alone, node.Wide });
+            }
+            Segment& segment = m_Segments.back();
+            segment.Count++;
+            node.Segment = static_cast<uint32_t>(m_Segments.size() - 1);
+
+            // Registration order decides the direction of every conflicting pair
+            for (uint32_t j = segment.First; j < i; ++j) {
+                if (m_Nodes[j].Access.ConflictsWith(node.Access)) {
+                    node.Dependencies.push_back(j);
+                    m_Nodes[j].Dependents.push_back(i);
+                    node.Level = std::max(node.Level, m_Nodes[j].Level + 1);
+                }
+            }
+        }
+
+        m_Remaining = std::make_unique<std::atomic<uint32_t>[]>(m_Nodes.size());
+        m_Dirty = false;
+
+        LOG_CORE_INFO("System schedule:\n{}", DumpSchedule());
+    }
+
+    void SystemScheduler::Run(float dt) {
+        PROFILE_SCOPE("SystemScheduler::Run");
+
+        if (m_Dirty) {
+            Build();
+        }
+
+        m_DeltaTime = dt;
+        for (const Segment& segment : m_Segments) {
+            RunSegment(segment);
+        }
+    }
+
+    void SystemScheduler::RunSegment(const Segment& segment) {
+        bool parallel = !segment.Exclusive && segment.Count > 1 && m_World && m_Jobs &&
+                        m_Jobs->GetThreadCount() > 1 &&
+                        m_World->get_stage_count() >= static_cast<int32_t>(m_Jobs->GetThreadCount());
+
+        if (!parallel) {
+            // Registration order is a valid topological order
+            for (uint32_t i = segment.First; i < segment.First + segment.Count; ++i) {
+                RunNode(i, *m_World);
+            }
+            return;
+        }
+
+        m_World->readonly_begin(true);
+
+        for (uint32_t i = segment.First; i < segment.First + segment.Count; ++i) {
+            m_Remaining[i].store(static_cast<uint32_t>(m_Nodes[i].Dependencies.size()), std::memory_order_relaxed);
+        }
+
+        JobCounter counter;
+        for (uint32_t i = segment.First; i < segment.First + segment.Count; ++i) {
+            if (m_Nodes[i].Dependencies.empty()) {
+                ScheduleNode(i, &counter);
+            }
+        }
+        m_Jobs->Wait(counter);
+
+        m_World->readonly_end();
+    }
+
+    void SystemScheduler::ScheduleNode(uint32_t index, JobCounter* counter) {
+        m_Jobs->Execute([this, index, counter]() {
+            flecs::world stage = m_World->get_stage(static_cast<int32_t>(m_Jobs->GetThreadIndex()));
+            RunNode(index, stage);
+
+            for (uint32_t dependent : m_Nodes[index].Dependents) {
+                if (m_Remaining[dependent].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                    ScheduleNode(dependent, counter);
+                }
+            }
+        }, counter);
+    }
+
+    void SystemScheduler::RunWorkers(uint64_t system, float dt) {
+        uint32_t threadCount = m_Jobs ? m_Jobs->GetThreadCount() : 1;
+        if (threadCount <= 1 || m_World->get_stage_count() < static_cast<int32_t>(threadCount)) {
+            ecs_run(m_World->c_ptr(), system, dt, nullptr);
+            return;
+        }
+
+        // Each job takes one worker slice; flecs splits the matched tables/rows by slice index.
+        // Jobs never wait, so a thread only ever has one slice in flight on its stage.
+        m_World->readonly_begin(true);
+
+        JobCounter counter;
+        for (uint32_t slice = 0; slice < threadCount; ++slice) {
+            m_Jobs->Execute([this, system, dt, slice, threadCount]() {
+                ZoneScopedN("SystemScheduler::Slice");
+                const char* name = ecs_get_name(m_World->c_ptr(), system);
+                if (name) {
+                    ZoneText(name, std::strlen(name));
+                }
+                flecs::world stage = m_World->get_stage(static_cast<int32_t>(m_Jobs->GetThreadIndex()));
+                ecs_run_worker(stage.c_ptr(), system, static_cast<int32_t>(slice),
+                    static_cast<int32_t>(threadCount), dt, nullptr);
+            }, &counter);
+        }
+        m_Jobs->Wait(counter);
+
+        m_World->readonly_end();
+    }
+
+    void SystemScheduler::RunNode(uint32_t index, flecs::world& world) {
+        Node& node = m_Nodes[index];
+        ZoneScoped;
+        ZoneName(node.Name.c_str(), node.Name.size());
+
+        auto start = std::chrono::high_resolution_clock::now();
+        node.Function(world, m_DeltaTime);
+        auto end = std::chrono::high_resolution_clock::now();
+
+        double ms = std::chrono::duration<double, std::milli>(end - start).count();
+        node.Stats.LastMs = ms;
+        node.Stats.AverageMs = node.Stats.AverageMs == 0.0 ? ms : node.Stats.AverageMs * 0.95 + ms * 0.05;
+        node.Stats.LastThread = m_Jobs ? m_Jobs->GetThreadIndex() : 0;
+    }
+
+    std::string SystemScheduler::DumpSchedule() const {
+        std::string out;
+        for (uint32_t s = 0; s < m_Segments.size(); ++s) {
+            const Segment& segment = m_Segments[s];
+            const char* kind = segment.Wide ? "multithreaded" : segment.Exclusive ? "exclusive" : "parallel";
+            out += fmt::format("Segment {} ({})\n", s, kind);
+
+            for (uint32_t i = segment.First; i < segment.First + segment.Count; ++i) {
+                const Node& node = m_Nodes[i];
+                std::string after;
+                for (uint32_t dependency : node.Dependencies) {
+                    after += after.empty() ? "" : ", ";
+                    after += m_Nodes[dependency].Name;
+                }
+                out += fmt::format("  [L{}] {:<28} {:>7.3f} ms (avg {:.3f}, thread {}){}{}\n",
+                    node.Level, node.Name, node.Stats.LastMs, node.Stats.AverageMs, node.Stats.LastThread,
+                    after.empty() ? "" : " after ", after);
+            }
+        }
+        return out;
+    }
+
+    void SystemScheduler::DrawDebugUI() const {
+        if (!ImGui::BeginTable("Schedule", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+            return;
+        }
+
+        ImGui::TableSetupColumn("System");
+        ImGui::TableSetupColumn("Seg/Lvl");
+        ImGui::TableSetupColumn("ms");
+        ImGui::TableSetupColumn("avg");
+        ImGui::TableSetupColumn("Thread");
+        ImGui::TableHeadersRow();
+
+        for (const Node& node : m_Nodes) {
+            ImGui::TableNextRow();
+            ImGui::TableNextColumn();
+            ImGui::TextUnformatted(node.Name.c_str());
+            ImGui::TableNextColumn();
+            ImGui::Text("%u/%u%s", node.Segment, node.Level, node.Wide ? " MT" : node.Access.Exclusive ? " X" : "");
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", node.Stats.LastMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%.3f", node.Stats.AverageMs);
+            ImGui::TableNextColumn();
+            ImGui::Text("%u", node.Stats.LastThread);
+        }
+
+        ImGui::EndTable();
+    }
+
+}
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "TypeId.h"
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace flecs {
+    class world;
+    struct system;
+}
+
+namespace Core {
+
+    class JobSystem;
+    class JobCounter;
+
+    // Component access declared by a scheduled system. Two systems conflict when either one
+    // writes a component the other touches; conflicting systems keep their registration order.
+    struct SystemAccess {
+        std::vector<HashValue> Reads;
+        std::vector<HashValue> Writes;
+        bool Exclusive = false; // Needs the world to itself (structural changes, ad-hoc queries, GPU work)
+
+        template<typename... Components>
+        SystemAccess& Read() {
+            (Reads.push_back(TypeIdOf<Components>), ...);
+            return *this;
+        }
+
+        template<typename... Components>
+        SystemAccess& Write() {
+            (Writes.push_back(TypeIdOf<Components>), ...);
+            return *this;
+        }
+
+        SystemAccess& MakeExclusive() {
+            Exclusive = true;
+            return *this;
+        }
+
+        bool ConflictsWith(const SystemAccess& other) const;
+    };
+
+    // Runs the per-tick systems as a dependency graph on the job system.
+    // Consecutive non-exclusive systems form a parallel segment: the world is put in readonly mode
+    // and each system runs against the flecs stage of the worker executing it. Exclusive systems
+    // run alone on the calling thread between segments. Flecs systems marked multi_threaded() get
+    // a segment of their own and have their matched entities split across every thread.
+    class SystemScheduler {
+    public:
+        // `world` is either the world itself (exclusive) or the current thread's stage
+        using SystemFunction = std::function<void(flecs::world& world, float dt)>;
+
+        struct NodeStats {
+            double LastMs = 0.0;
+            double AverageMs = 0.0;
+            uint32_t LastThread = 0;
+        };
+
+        SystemScheduler();
+        ~SystemScheduler();
+
+        // Binds the world and configures one flecs stage per job system thread
+        void Init(flecs::world& world, JobSystem* jobs);
+
+        void AddSystem(const std::string& name, const SystemAccess& access, SystemFunction function);
+        // Convenience for flecs systems registered without a phase. multi_threaded() systems are split
+        // across all job system threads.
+        void AddSystem(const std::string& name, const SystemAccess& access, const flecs::system& system);
+
+        void Run(float dt);
+
+        // Human readable schedule (segments, dependencies, timings)
+        std::string DumpSchedule() const;
+        void DrawDebugUI() const;
+
+        uint32_t GetNodeCount() const { return static_cast<uint32_t>(m_Nodes.size()); }
+        const std::string& GetNodeName(uint32_t index) const { return m_Nodes[index].Name; }
+        const NodeStats& GetNodeStats(uint32_t index) const { return m_Nodes[index].Stats; }
+
+    private:
+        struct Node {
+            std::string Name;
+            SystemAccess Access;
+            SystemFunction Function;
+            std::vector<uint32_t> Dependencies; // Earlier nodes in the same segment
+            std::vector<uint32_t> Dependents;   // Later nodes in the same segment
+            bool Wide = false;                  // Multithreaded flecs system, runs in its own segment
+            uint32_t Segment = 0;
+            uint32_t Level = 0;
+            NodeStats Stats;
+        };
+
+        struct Segment {
+            uint32_t First = 0;
+            uint32_t Count = 0;
+            bool Exclusive = false;
+            bool Wide = false;
+        };
+
+        void Build();
+        void RunSegment(const Segment& segment);
+        void RunNode(uint32_t index, flecs::world& world);
+        void ScheduleNode(uint32_t index, JobCounter* counter);
+        void RunWorkers(uint64_t system, float dt); // system is a flecs::entity_t
+
+        flecs::world* m_World = nullptr;
+        JobSystem* m_Jobs = nullptr;
+
+        std::vector<Node> m_Nodes;
+        std::vector<Segment> m_Segments;
+        std::unique_ptr<std::atomic<uint32_t>[]> m_Remaining; // Unfinished dependencies per node
+        bool m_Dirty = true;
+        float m_DeltaTime = 0.0f;
+    };
+
+}
@@ -0,0 +1,207 @@
+#include "Telemetry.h"
+#include "Log.h"
+#include <nlohmann/json.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <fstream>
+#include <mutex>
+#include <vector>
+
+namespace Core {
+
+    namespace {
+        std::mutex s_PhaseLock; // Guards registration; readers go through s_PhaseCount
+        std::array<std::string, Telemetry::MaxPhases> s_PhaseNames;
+        std::atomic<uint32_t> s_PhaseCount{0};
+        std::array<std::atomic<uint64_t>, Telemetry::MaxPhases> s_PhaseNanoseconds{};
+
+        std::vector<Telemetry::Frame> s_Frames; // Ring, allocated on the first frame
+        uint32_t s_Head = 0;                    // Next slot to write
+        uint32_t s_Count = 0;
+        uint64_t s_NextIndex = 0;
+
+        std::vector<double> s_SortScratch;
+
+        // Column order for both dumps
+        constexpr size_t CounterCount = 11;
+        constexpr const char* CounterNames[CounterCount] = {
+            "drawCalls", "instances", "skinnedInstances", "culledInstances", "lights", "entities",
+            "bodies", "uploadBytes", "stagingBytes", "heapAllocations", "frameMemoryBytes"
+        };
+
+        std::array<uint64_t, CounterCount> CounterValues(const Telemetry::FrameCounters& c) {
+            return { c.DrawCalls, c.Instances, c.SkinnedInstances, c.CulledInstances, c.Lights, c.Entities,
+                     c.Bodies, c.UploadBytes, c.StagingBytes, c.HeapAllocations, c.FrameMemoryBytes };
+        }
+
+        double Percentile(std::vector<double>& values, double p) {
+            size_t rank = static_cast<size_t>(std::ceil(p * values.size()));
+            size_t index = std::min(values.size() - 1, rank > 0 ? rank - 1 : 0);
+            std::nth_element(values.begin(), values.begin() + index, values.end());
+            return values[index];
+        }
+
+        nlohmann::json SummaryToJson(const Telemetry::Summary& summary) {
+            return { {"p50", summary.P50}, {"p95", summary.P95}, {"p99", summary.P99},
+                     {"mean", summary.Mean}, {"max", summary.Max} };
+        }
+    }
+
+    uint32_t Telemetry::RegisterPhase(const char* name) {
+        std::lock_guard<std::mutex> lock(s_PhaseLock);
+        uint32_t count = s_PhaseCount.load(std::memory_order_relaxed);
+        for (uint32_t i = 0; i < count; ++i) {
+            if (s_PhaseNames[i] == name) return i;
+        }
+        if (count == MaxPhases) {
+            LOG_CORE_WARN("Telemetry: phase limit reached, '{}' is not recorded", name);
+            return InvalidPhase;
+        }
+        s_PhaseNames[count] = name;
+        s_PhaseCount.store(count + 1, std::memory_order_release);
+        return count;
+    }
+
+    uint32_t Telemetry::GetPhaseCount() {
+        return s_PhaseCount.load(std::memory_order_acquire);
+    }
+
+    const std::string& Telemetry::GetPhaseName(uint32_t phase) {
+        return s_PhaseNames[phase];
+    }
+
+    void Telemetry::AddPhaseTime(uint32_t phase, uint64_t nanoseconds) {
+        if (phase >= MaxPhases) return;
+        s_PhaseNanoseconds[phase].fetch_add(nanoseconds, std::memory_order_relaxed);
+    }
+
+    void Telemetry::EndFrame(double frameMs, const FrameCounters& counters) {
+        if (s_Frames.empty()) {
+            s_Frames.resize(Capacity);
+        }
+
+        Frame& frame = s_Frames[s_Head];
+        frame.Index = s_NextIndex++;
+        frame.FrameMs = static_cast<float>(frameMs);
+        frame.Counters = counters;
+        for (uint32_t i = 0; i < MaxPhases; ++i) {
+            frame.PhaseMs[i] = static_cast<float>(s_PhaseNanoseconds[i].exchange(0, std::memory_order_relaxed) / 1.0e6);
+        }
+
+        s_Head = (s_Head + 1) % Capacity;
+        s_Count = std::min(s_Count + 1, Capacity);
+    }
+
+    uint32_t Telemetry::GetFrameCount() {
+        return s_Count;
+    }
+
+    const Telemetry::Frame& Telemetry::GetFrame(uint32_t i) {
+        return s_Frames[(s_Head + Capacity - s_Count + i) % Capacity];
+    }
+
+    Telemetry::Summary Telemetry::Summarize(uint32_t phase) {
+        Summary summary;
+        if (s_Count == 0) return summary;
+
+        s_SortScratch.clear();
+        double total = 0.0;
+        for (uint32_t i = 0; i < s_Count; ++i) {
+            const Frame& frame = GetFrame(i);
+            double ms = phase < MaxPhases ? frame.PhaseMs[phase] : frame.FrameMs;
+            s_SortScratch.push_back(ms);
+            total += ms;
+            summary.Max = std::max(summary.Max, ms);
+        }
+        summary.Mean = total / s_Count;
+        summary.P50 = Percentile(s_SortScratch, 0.50);
+        summary.P95 = Percentile(s_SortScratch, 0.95);
+        summary.P99 = Percentile(s_SortScratch, 0.99);
+        return summary;
+    }
+
+    void Telemetry::Reset() {
+        s_Head = 0;
+        s_Count = 0;
+        for (auto& nanoseconds : s_PhaseNanoseconds) {
+            nanoseconds.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    bool Telemetry::WriteCsv(const std::string& path) {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            LOG_CORE_ERROR("Telemetry: could not open {}", path);
+            return false;
+        }
+
+        uint32_t phaseCount = GetPhaseCount();
+        file << "frame,frameMs";
+        for (uint32_t p = 0; p < phaseCount; ++p) {
+            file << "," << s_PhaseNames[p] << "Ms";
+        }
+        for (const char* name : CounterNames) {
+            file << "," << name;
+        }
+        file << "\n";
+
+        for (uint32_t i = 0; i < s_Count; ++i) {
+            const Frame& frame = GetFrame(i);
+            file << frame.Index << "," << frame.FrameMs;
+            for (uint32_t p = 0; p < phaseCount; ++p) {
+                file << "," << frame.PhaseMs[p];
+            }
+            for (uint64_t value : CounterValues(frame.Counters)) {
+                file << "," << value;
+            }
+            file << "\n";
+        }
+
+        LOG_CORE_INFO("Telemetry: wrote {} frames to {}", s_Count, path);
+        return true;
+    }
+
+    nlohmann::json Telemetry::ToJson() {
+        nlohmann::json report;
+        report["frames"] = s_Count;
+        report["frameMs"] = SummaryToJson(Summarize());
+
+        nlohmann::json phases = nlohmann::json::object();
+        for (uint32_t p = 0; p < GetPhaseCount(); ++p) {
+            phases[s_PhaseNames[p]] = SummaryToJson(Summarize(p));
+        }
+        report["phasesMs"] = phases;
+
+        // Counters are reported as per-frame means and peaks
+        std::array<double, CounterCount> sums{};
+        std::array<uint64_t, CounterCount> peaks{};
+        for (uint32_t i = 0; i < s_Count; ++i) {
+            std::array<uint64_t, CounterCount> values = CounterValues(GetFrame(i).Counters);
+            for (size_t v = 0; v < CounterCount; ++v) {
+                sums[v] += static_cast<double>(values[v]);
+                peaks[v] = std::max(peaks[v], values[v]);
+            }
+        }
+        nlohmann::json counters = nlohmann::json::object();
+        for (size_t v = 0; v < CounterCount; ++v) {
+            counters[CounterNames[v]] = { {"mean", s_Count ? sums[v] / s_Count : 0.0}, {"max", peaks[v]} };
+        }
+        report["counters"] = counters;
+        return report;
+    }
+
+    bool Telemetry::WriteJson(const std::string& path) {
+        std::ofstream file(path);
+        if (!file.is_open()) {
+            LOG_CORE_ERROR("Telemetry: could not open {}", path);
+            return false;
+        }
+
+        file << ToJson().dump(4);
+        LOG_CORE_INFO("Telemetry: wrote summary to {}", path);
+        return true;
+    }
+
+}
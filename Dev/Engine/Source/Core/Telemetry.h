@@ -0,0 +1,94 @@
+#pragma once
+
+#include <nlohmann/json_fwd.hpp>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace Core {
+
+    // Always-on frame recorder. Every PROFILE_SCOPE adds its CPU time to a per-frame phase total
+    // (scopes entered on several threads, or several times, are summed), and Engine::Step closes
+    // each frame with its counters. The last Capacity frames are kept for the debug graphs and
+    // for the CSV/JSON dumps written with --perf-log.
+    class Telemetry {
+    public:
+        static constexpr uint32_t MaxPhases = 64;    // Later scopes only show up in Tracy
+        static constexpr uint32_t Capacity = 8192;   // Frames kept
+        static constexpr uint32_t InvalidPhase = ~0u;
+
+        struct FrameCounters {
+            uint32_t DrawCalls = 0;        // Issued to the RenderDevice
+            uint32_t Instances = 0;
+            uint32_t SkinnedInstances = 0;
+            uint32_t CulledInstances = 0;  // Outside the camera frustum
+            uint32_t Lights = 0;
+            uint32_t Entities = 0;         // Entities with a transform
+            uint32_t Bodies = 0;           // Physics bodies
+            uint64_t UploadBytes = 0;
+            uint64_t StagingBytes = 0;     // Copied into the staging ring, textures included
+            uint64_t HeapAllocations = 0;  // Only counted with OAKEN_TRACK_ALLOCATIONS
+            uint64_t FrameMemoryBytes = 0; // Handed out by the FrameAllocator
+        };
+
+        struct Frame {
+            uint64_t Index = 0;
+            float FrameMs = 0.0f;
+            float PhaseMs[MaxPhases] = {};
+            FrameCounters Counters;
+        };
+
+        struct Summary {
+            double P50 = 0.0;
+            double P95 = 0.0;
+            double P99 = 0.0;
+            double Mean = 0.0;
+            double Max = 0.0;
+        };
+
+        // Returns the same index for the same name. Thread-safe.
+        static uint32_t RegisterPhase(const char* name);
+        static uint32_t GetPhaseCount();
+        static const std::string& GetPhaseName(uint32_t phase);
+
+        // Thread-safe
+        static void AddPhaseTime(uint32_t phase, uint64_t nanoseconds);
+
+        // Main thread, once per frame, while no scope is open on another thread
+        static void EndFrame(double frameMs, const FrameCounters& counters);
+
+        // Oldest first. Main thread only, like EndFrame.
+        static uint32_t GetFrameCount();
+        static const Frame& GetFrame(uint32_t i);
+
+        // Over the recorded frames; phase InvalidPhase means whole-frame time
+        static Summary Summarize(uint32_t phase = InvalidPhase);
+
+        // Forgets the recorded frames (phases stay registered), e.g. once a benchmark has warmed up
+        static void Reset();
+
+        // Frame and phase summaries plus counter means/peaks, as written by WriteJson
+        static nlohmann::json ToJson();
+
+        static bool WriteCsv(const std::string& path);
+        static bool WriteJson(const std::string& path);
+    };
+
+    // Times one PROFILE_SCOPE into its phase
+    class TelemetryScope {
+    public:
+        explicit TelemetryScope(uint32_t phase) : m_Phase(phase), m_Start(std::chrono::steady_clock::now()) {}
+        ~TelemetryScope() {
+            auto elapsed = std::chrono::steady_clock::now() - m_Start;
+            Telemetry::AddPhaseTime(m_Phase, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+
+        TelemetryScope(const TelemetryScope&) = delete;
+        TelemetryScope& operator=(const TelemetryScope&) = delete;
+
+    private:
+        uint32_t m_Phase;
+        std::chrono::steady_clock::time_point m_Start;
+    };
+
+}
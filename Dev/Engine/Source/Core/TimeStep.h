@@ -6,8 +6,10 @@ namespace Core {
         double DeltaTime = 0.0;
         double TotalTime = 0.0;
         
-        // Fixed time step for physics
+        // Default fixed time step for physics/gameplay (see Engine::SetFixedTickRate)
         static constexpr double FixedDeltaTime = 1.0 / 60.0;
+        static constexpr double MinTickRate = 10.0;
+        static constexpr double MaxTickRate = 240.0;
     };
 
 }
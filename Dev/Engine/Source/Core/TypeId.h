@@ -0,0 +1,25 @@
+#pragma once
+
+#include "HashedString.h"
+#include <string_view>
+#include <type_traits>
+
+namespace Core {
+
+    namespace Detail {
+        template<typename T>
+        constexpr std::string_view TypeSignature() {
+#if defined(_MSC_VER) && !defined(__clang__)
+            return __FUNCSIG__;
+#else
+            return __PRETTY_FUNCTION__;
+#endif
+        }
+    }
+
+    // Compile-time type identifier. Unlike typeid or the address of a template static,
+    // the value is identical in the engine and in game DLLs.
+    template<typename T>
+    inline constexpr HashValue TypeIdOf = FNV1a_32(Detail::TypeSignature<std::remove_cvref_t<T>>());
+
+}
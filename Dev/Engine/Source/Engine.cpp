@@ -2,12 +2,19 @@
 #include "Core/Profiler.h"
 #include "Core/TimeStep.h"
 #include "Core/Log.h"
+#include "Core/FrameAllocator.h"
+#include "Core/AllocationTracker.h"
+#include "Core/Telemetry.h"
 #include "Components/Components.h"
 #include "Components/Reflection.h"
 #include "Scene/SceneSerializer.h"
 #include <nlohmann/json.hpp>
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstdio>
+#include <filesystem>
 #include <fstream>
-#include <iostream>
 
 using json = nlohmann::json;
 
@@ -16,6 +23,8 @@ Engine::Engine() {
     LOG_CORE_INFO("Initializing Oaken Engine...");
 
     m_EventBus = std::make_unique<Core::EventBus>();
+    m_JobSystem = std::make_unique<Core::JobSystem>();
+    m_JobSystem->Init();
     m_SceneManager = std::make_unique<Core::SceneManager>();
     m_Input = std::make_unique<Platform::Input>();
     m_ResourceManager = std::make_unique<Resources::ResourceManager>();
@@ -24,6 +33,7 @@ Engine::Engine() {
     // World will be set when a scene is loaded
     m_Context.World = nullptr;
     m_Context.Events = m_EventBus.get();
+    m_Context.Jobs = m_JobSystem.get();
 
     // Create Systems
     m_AbilitySystem = std::make_unique<Systems::AbilitySystem>(m_Context);
@@ -39,27 +49,44 @@ Engine::~Engine() {
 }
 
 bool Engine::Init() {
-    Platform::WindowProps props = { "Oaken Engine", 1280, 720 };
-    m_Window = std::make_unique<Platform::Window>(props);
-    
-    if (!m_Window->Init()) {
-        return false;
-    }
+    if (m_Headless) {
+        LOG_CORE_INFO("Running headless (no window, {}){}", m_NullRenderer ? "null GPU backend" : "no GPU device",
+                      m_SimulatedClock ? ", simulated clock" : "");
+
+        if (m_NullRenderer) {
+            m_RenderDevice = std::make_unique<Platform::RenderDevice>();
+            if (!m_RenderDevice->InitNull()) {
+                return false;
+            }
+        }
+    } else {
+        Platform::WindowProps props = { "Oaken Engine", 1280, 720 };
+        m_Window = std::make_unique<Platform::Window>(props);
+        
+        if (!m_Window->Init()) {
+            return false;
+        }
 
-    m_RenderDevice = std::make_unique<Platform::RenderDevice>();
-    if (!m_RenderDevice->Init(m_Window.get())) {
-        return false;
+        m_RenderDevice = std::make_unique<Platform::RenderDevice>();
+        if (!m_RenderDevice->Init(m_Window.get())) {
+            return false;
+        }
     }
 
+    // Without a device resources keep their CPU-side data only
     m_ResourceManager->Init(m_RenderDevice.get());
 
-    // Initialize ImGui before RenderSystem
-    InitImGui();
+    if (!m_Headless) {
+        // Initialize ImGui before RenderSystem
+        InitImGui();
+    }
 
-    m_RenderSystem = std::make_unique<Systems::RenderSystem>(m_Context, *m_RenderDevice, *m_ResourceManager);
-    m_RenderSystem->Init();
+    if (m_RenderDevice) {
+        m_RenderSystem = std::make_unique<Systems::RenderSystem>(m_Context, *m_RenderDevice, *m_ResourceManager);
+        m_RenderSystem->Init();
+    }
 
-    m_Input->Init(m_EventBus.get(), m_Window->GetNativeWindow());
+    m_Input->Init(m_EventBus.get(), m_Window ? m_Window->GetNativeWindow() : nullptr);
     
     // Create and Load Scene
     auto scene = std::make_unique<Core::Scene>();
@@ -71,7 +98,7 @@ bool Engine::Init() {
     } else {
         LOG_CORE_WARN("Failed to load Test.oaklevel, creating default scene");
         auto e = scene->GetWorld().entity("Player")
-            .set<LocalTransform>({ {0,0,0}, {0,0,0}, {1,1,1} });
+            .set<LocalTransform>({});
     }
 
     m_SceneManager->LoadScene(std::move(scene));
@@ -86,12 +113,28 @@ bool Engine::Init() {
     m_TransformSystem->Init();
     m_CameraSystem = std::make_unique<Systems::CameraSystem>(*m_Context.World, *m_Input);
     m_CharacterSystem = std::make_unique<Systems::CharacterSystem>(*m_Context.World, *m_Input);
+
+    BuildSchedule();
     
     // Map some test input
     m_Input->MapAction("Cast_Slot_1"_hs, SDL_SCANCODE_SPACE);
     
     // Load config file (overrides defaults)
     LoadConfig();
+
+    if (m_Benchmark) {
+        // The scenario decides these, whatever engine.json says. The clock is simulated even with
+        // --realtime: one fixed tick per frame, so every run simulates exactly the same frames.
+        m_SimulatedClock = true;
+        SetFixedTickRate(m_Benchmark->TickRate);
+        m_ShowColliders = m_Benchmark->DebugDraw;
+        m_ShowSkeleton = m_Benchmark->DebugDraw;
+        if (m_RenderDevice) {
+            m_RenderDevice->SetVSync(false);
+        }
+        LOG_CORE_INFO("Benchmark '{}': {} warm-up + {} measured frames at {:.0f} Hz",
+            m_Benchmark->Name, m_Benchmark->WarmupFrames, m_Benchmark->Frames, m_Benchmark->TickRate);
+    }
     
     // Initialize time
     m_CurrentTime = SDL_GetTicks() / 1000.0;
@@ -103,16 +146,24 @@ bool Engine::Init() {
 }
 
 bool Engine::Step() {
-    if (!m_IsRunning || m_Window->ShouldClose()) {
+    if (!m_IsRunning || (m_Window && m_Window->ShouldClose())) {
         return false;
     }
 
     PROFILE_FRAME("MainLoop");
-
-    uint64_t newTicks = SDL_GetTicks();
-    double newTime = newTicks / 1000.0;
-    double frameTime = newTime - m_CurrentTime;
-    m_CurrentTime = newTime;
+    uint64_t frameStart = SDL_GetTicksNS();
+    uint64_t allocationsStart = Core::AllocationTracker::GetAllocationCount();
+
+    // Last frame's transient memory. Nothing runs on the job system between steps.
+    Core::FrameAllocator::ResetAll();
+
+    double frameTime = m_FixedDeltaTime;
+    if (!m_SimulatedClock) {
+        uint64_t newTicks = SDL_GetTicks();
+        double newTime = newTicks / 1000.0;
+        frameTime = newTime - m_CurrentTime;
+        m_CurrentTime = newTime;
+    }
     
     // Prevent spiral of death
     if (frameTime > 0.25) frameTime = 0.25;
@@ -121,12 +172,25 @@ bool Engine::Step() {
 
     if (m_TimeLimit > 0.0 && m_TotalTime >= m_TimeLimit) {
         LOG_CORE_INFO("Time limit reached ({:.2f}s). Shutting down.", m_TimeLimit);
+        if (Core::AllocationTracker::IsEnabled()) {
+            LOG_CORE_INFO("Heap allocations in the last frame: {}", m_FrameStats.HeapAllocations);
+        }
         m_IsRunning = false;
         return false;
     }
 
-    // 1. Input
-    {
+    if (m_StressScene) {
+        Core::StressSceneGenerator(*m_StressScene).Generate(*m_Context.World, *m_ResourceManager);
+        m_StressScene.reset();
+    }
+
+    if (m_Benchmark && !UpdateBenchmark()) {
+        m_IsRunning = false;
+        return false;
+    }
+
+    // 1. Input (headless has no window to receive events)
+    if (!m_Headless) {
         PROFILE_SCOPE("Input");
         m_Input->Poll();
         
@@ -135,7 +199,10 @@ bool Engine::Step() {
             // Let ImGui process events first
             ImGui_ImplSDL3_ProcessEvent(&event);
             
-            m_Input->ProcessEvent(event);
+            // A benchmark ignores the player, so every run simulates the same thing
+            if (!m_Benchmark) {
+                m_Input->ProcessEvent(event);
+            }
             if (event.type == SDL_EVENT_QUIT) {
                 m_Window->SetShouldClose(true);
             }
@@ -148,25 +215,18 @@ bool Engine::Step() {
         HandleDebugInput();
     }
 
-    // 2. Physics/Logic (Fixed Step)
-    double dt = Core::TimeStep::FixedDeltaTime;
-    {
-        PROFILE_SCOPE("FixedUpdate");
-        while (m_Accumulator >= dt) {
-            Update(dt);
-            m_Accumulator -= dt;
-            m_TotalTime += dt;
-        }
-    }
+    // 2. Resources. Hot reload touches the GPU, so it stays on the main thread.
+    m_ResourceManager->Update();
 
-    // 3. Render (Interpolated)
-    double alpha = m_Accumulator / dt;
-    {
-        PROFILE_SCOPE("Render");
-        
-        // Update FPS counter
+    // 3. UI. Reads and edits the world, which is idle here in both render modes.
+    if (m_RenderSystem) {
         UpdateFPSCounter(static_cast<float>(frameTime));
-        
+    }
+
+    bool drawUI = m_RenderSystem && !m_Headless;
+    if (drawUI) {
+        PROFILE_SCOPE("UI");
+
         // Start new ImGui frame
         ImGui_ImplSDLGPU3_NewFrame();
         ImGui_ImplSDL3_NewFrame();
@@ -175,38 +235,61 @@ bool Engine::Step() {
         // Render debug menu (creates ImGui draw commands)
         RenderDebugMenu();
         
-        // Finalize ImGui draw data
-        ImGui::Render();
-        
-        // Start the render system frame (acquires command buffer)
-        m_RenderSystem->BeginFrame(m_ShowSkeleton);
-        
-        // Prepare ImGui draw data (uploads vertex/index buffers) - must be before render pass
-        Imgui_ImplSDLGPU3_PrepareDrawData(ImGui::GetDrawData(), m_RenderDevice->GetCommandBuffer());
-        
-        // Debug: Draw physics colliders (must be before DrawScene so lines get rendered)
-        if (m_ShowColliders) {
-            m_RenderSystem->DrawPhysicsDebug();
-        }
-        
-        // Draw the scene (this starts and uses the render pass)
-        m_RenderSystem->DrawScene(alpha);
-        
         if (m_EditorMode) {
             m_EditorSystem->DrawUI(m_Context.World);
         }
         
-        // Run bloom + tone mapping (renders to swapchain, leaves pass open for UI)
-        m_RenderSystem->EndFrame();
-        
-        // Render ImGui AFTER tone mapping so it doesn't get bloomed
-        ImGui_ImplSDLGPU3_RenderDrawData(ImGui::GetDrawData(), 
-                                          m_RenderDevice->GetCommandBuffer(),
-                                          m_RenderDevice->GetRenderPass());
-        
-        // End render pass and submit command buffer
-        m_RenderSystem->FinishFrame();
+        // Finalize ImGui draw data
+        ImGui::Render();
+    }
+
+    // 4. Physics/Logic (Fixed Step)
+    double dt = m_FixedDeltaTime;
+    uint32_t ticks = 0;
+    while (m_Accumulator >= dt) {
+        m_Accumulator -= dt;
+        m_TotalTime += dt;
+        ticks++;
     }
+    double alpha = m_Accumulator / dt;
+
+    // 5. Render (Interpolated)
+    if (!m_RenderSystem) {
+        Simulate(ticks, alpha, nullptr);
+    } else if (!m_PipelinedRendering) {
+        Systems::RenderSnapshot& snapshot = m_Snapshots[m_SnapshotIndex];
+        Simulate(ticks, alpha, &snapshot);
+        Render(snapshot, drawUI);
+        m_SnapshotReady = false;
+    } else {
+        // Record the snapshot the previous Step() produced while the job system simulates the next one.
+        // The simulation is finished before returning, so the world is never touched between steps.
+        if (!m_SnapshotReady) {
+            m_RenderSystem->Extract(m_Snapshots[m_SnapshotIndex], alpha, m_ShowSkeleton, m_ShowColliders);
+        }
+        Systems::RenderSnapshot& front = m_Snapshots[m_SnapshotIndex];
+        Systems::RenderSnapshot* back = &m_Snapshots[m_SnapshotIndex ^ 1];
+
+        Core::JobCounter simulation;
+        m_JobSystem->Execute([this, ticks, alpha, back]() { Simulate(ticks, alpha, back); }, &simulation);
+
+        Render(front, drawUI);
+
+        uint64_t waitStart = SDL_GetTicksNS();
+        {
+            PROFILE_SCOPE("WaitForSimulation");
+            m_JobSystem->Wait(simulation);
+        }
+        AccumulateFrameStat(m_FrameStats.WaitMs, (SDL_GetTicksNS() - waitStart) / 1.0e6);
+
+        m_SnapshotIndex ^= 1;
+        m_SnapshotReady = true;
+    }
+
+    double frameMs = (SDL_GetTicksNS() - frameStart) / 1.0e6;
+    AccumulateFrameStat(m_FrameStats.FrameMs, frameMs);
+    m_FrameStats.HeapAllocations = Core::AllocationTracker::GetAllocationCount() - allocationsStart;
+    RecordTelemetry(frameMs);
 
     return true;
 }
@@ -216,36 +299,143 @@ void Engine::Run() {
     while (Step()) {}
 }
 
+void Engine::BuildSchedule() {
+    m_Scheduler = std::make_unique<Core::SystemScheduler>();
+    m_Scheduler->Init(*m_Context.World, m_JobSystem.get());
+
+    // Registration order is execution order for systems whose access conflicts.
+    // Exclusive steps own the world; everything between two of them may run concurrently.
+    m_CharacterSystem->Schedule(*m_Scheduler);
+    m_Scheduler->AddSystem("Physics", Core::SystemAccess().MakeExclusive(), [this](flecs::world&, float dt) {
+        m_PhysicsSystem->Step(dt);
+    });
+    m_Scheduler->AddSystem("Scripts", Core::SystemAccess().MakeExclusive(), [this](flecs::world&, float dt) {
+        m_ScriptSystem->Update(dt);
+    });
+    // Game module systems still live in the flecs pipeline
+    m_Scheduler->AddSystem("FlecsPipeline", Core::SystemAccess().MakeExclusive(), [this](flecs::world&, float dt) {
+        m_SceneManager->Update(dt);
+    });
+    m_CameraSystem->Schedule(*m_Scheduler);
+    m_AnimationSystem->Schedule(*m_Scheduler);
+    m_TransformSystem->Schedule(*m_Scheduler);
+    m_Scheduler->AddSystem("Abilities", Core::SystemAccess(), [this](flecs::world&, float dt) {
+        m_AbilitySystem->TickCooldowns(dt);
+    });
+}
+
+void Engine::SetFixedTickRate(double hz) {
+    double clamped = std::clamp(hz, Core::TimeStep::MinTickRate, Core::TimeStep::MaxTickRate);
+    if (clamped != hz) {
+        LOG_CORE_WARN("Tick rate {:.1f} Hz out of range, using {:.1f} Hz", hz, clamped);
+    }
+    m_FixedDeltaTime = 1.0 / clamped;
+}
+
 void Engine::Update(double dt) {
-    m_ResourceManager->Update();
+    m_Scheduler->Run(static_cast<float>(dt));
+
+    // Sync point: every system is done, deliver what they enqueued this tick
+    m_EventBus->DispatchQueued();
+
+    m_FlecsProfiler.Sample(*m_Context.World);
+}
+
+void Engine::Simulate(uint32_t ticks, double alpha, Systems::RenderSnapshot* snapshot) {
+    uint64_t start = SDL_GetTicksNS();
+    {
+        PROFILE_SCOPE("FixedUpdate");
+        for (uint32_t i = 0; i < ticks; ++i) {
+            // Rendering blends the state before and after the final tick
+            if (i + 1 == ticks) {
+                m_TransformSystem->StorePreviousTransforms();
+            }
+            Update(m_FixedDeltaTime);
+        }
+    }
+
+    if (snapshot) {
+        PROFILE_SCOPE("Extract");
+        m_RenderSystem->Extract(*snapshot, alpha, m_ShowSkeleton, m_ShowColliders);
+    }
+
+    AccumulateFrameStat(m_FrameStats.SimulationMs, (SDL_GetTicksNS() - start) / 1.0e6);
+}
+
+void Engine::Render(const Systems::RenderSnapshot& snapshot, bool drawUI) {
+    PROFILE_SCOPE("Render");
+    uint64_t start = SDL_GetTicksNS();
+
+    // Start the render system frame (acquires command buffer)
+    {
+        PROFILE_SCOPE("Render::Acquire");
+        m_RenderSystem->BeginFrame();
+    }
     
-    // Run Flecs Systems (e.g. Animation)
-    if (m_Context.World) {
-        m_Context.World->progress(dt);
+    // Prepare ImGui draw data (uploads vertex/index buffers) - must be before render pass
+    if (drawUI) {
+        Imgui_ImplSDLGPU3_PrepareDrawData(ImGui::GetDrawData(), m_RenderDevice->GetCommandBuffer());
+    }
+    
+    // Draw the scene (this starts and uses the render pass)
+    {
+        PROFILE_SCOPE("Render::Scene");
+        m_RenderSystem->DrawScene(snapshot);
+    }
+    
+    // Run bloom + tone mapping (renders to swapchain, leaves pass open for UI)
+    {
+        PROFILE_SCOPE("Render::PostProcess");
+        m_RenderSystem->EndFrame();
+    }
+    
+    // Render ImGui AFTER tone mapping so it doesn't get bloomed
+    if (drawUI) {
+        PROFILE_SCOPE("Render::UI");
+        ImGui_ImplSDLGPU3_RenderDrawData(ImGui::GetDrawData(), 
+                                          m_RenderDevice->GetCommandBuffer(),
+                                          m_RenderDevice->GetRenderPass());
+    }
+    
+    // End render pass and submit command buffer
+    {
+        PROFILE_SCOPE("Render::Submit");
+        m_RenderSystem->FinishFrame();
     }
 
-    m_PhysicsSystem->Step(dt);
-    m_AbilitySystem->TickCooldowns(dt);
-    m_ScriptSystem->Update(dt);
-    m_SceneManager->Update(dt);
+    uint64_t end = SDL_GetTicksNS();
+    AccumulateFrameStat(m_FrameStats.RenderMs, (end - start) / 1.0e6);
+    AccumulateFrameStat(m_FrameStats.LatencyMs, (end - snapshot.extractedAt) / 1.0e6);
 }
 
-void Engine::Render(double alpha) {
-    (void)alpha;
-    // Render logic moved to RenderSystem
+void Engine::AccumulateFrameStat(double& average, double ms) {
+    average = average == 0.0 ? ms : average * 0.95 + ms * 0.05;
 }
 
 void Engine::Shutdown() {
+    if (!m_PerfLogPath.empty()) {
+        WritePerfLog();
+        m_PerfLogPath.clear(); // Shutdown() may run twice
+    }
+    if (!m_BenchmarkReportPath.empty()) {
+        WriteBenchmarkReport();
+        m_BenchmarkReportPath.clear();
+    }
+
     // 1. Shutdown ImGui
     ShutdownImGui();
 
     // 2. Destroy Systems (Release references to World/Context)
+    m_Scheduler.reset();
     m_AbilitySystem.reset();
     m_PhysicsSystem.reset();
     m_ScriptSystem.reset();
     m_EditorSystem.reset();
     m_TransformSystem.reset();
     m_RenderSystem.reset();
+    for (Systems::RenderSnapshot& snapshot : m_Snapshots) {
+        snapshot = {};  // Holds meshes, which release their buffers through the RenderDevice
+    }
 
     // 3. Destroy SceneManager (Destroys Scene and World)
     m_SceneManager.reset();
@@ -259,6 +449,12 @@ void Engine::Shutdown() {
 
     // 6. Destroy Window
     m_Window.reset();
+
+    // 7. Stop worker threads (nothing above may still be using them)
+    if (m_JobSystem) {
+        m_JobSystem->Shutdown();
+    }
+    m_Context.Jobs = nullptr;
 }
 
 void Engine::InitImGui() {
@@ -287,6 +483,11 @@ void Engine::InitImGui() {
 }
 
 void Engine::ShutdownImGui() {
+    // Never created when headless, and Shutdown() may run twice
+    if (!ImGui::GetCurrentContext()) {
+        return;
+    }
+
     ImGui_ImplSDLGPU3_Shutdown();
     ImGui_ImplSDL3_Shutdown();
     ImGui::DestroyContext();
@@ -319,6 +520,164 @@ void Engine::HandleDebugInput() {
     }
 }
 
+void Engine::RenderTelemetryUI() {
+    constexpr uint32_t GraphFrames = 240;
+    uint32_t count = Core::Telemetry::GetFrameCount();
+    if (count == 0) return;
+
+    // Plots the last GraphFrames frames of one phase, or of the whole frame
+    struct PlotSource {
+        uint32_t First;
+        uint32_t Phase;
+    };
+    auto getter = [](void* data, int i) {
+        const PlotSource& source = *static_cast<const PlotSource*>(data);
+        const Core::Telemetry::Frame& frame = Core::Telemetry::GetFrame(source.First + i);
+        return source.Phase < Core::Telemetry::MaxPhases ? frame.PhaseMs[source.Phase] : frame.FrameMs;
+    };
+    uint32_t first = count > GraphFrames ? count - GraphFrames : 0;
+    int samples = static_cast<int>(count - first);
+
+    Core::Telemetry::Summary summary = Core::Telemetry::Summarize();
+    ImGui::Text("%u frames | p50 %.2f | p95 %.2f | p99 %.2f ms", count, summary.P50, summary.P95, summary.P99);
+    PlotSource frameSource{ first, Core::Telemetry::InvalidPhase };
+    ImGui::PlotLines("Frame", getter, &frameSource, samples, 0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+
+    const Core::Telemetry::Frame& last = Core::Telemetry::GetFrame(count - 1);
+    const Core::Telemetry::FrameCounters& counters = last.Counters;
+    ImGui::Text("Draws: %u | Instances: %u | Skinned: %u | Lights: %u",
+        counters.DrawCalls, counters.Instances, counters.SkinnedInstances, counters.Lights);
+    ImGui::Text("Entities: %u | Bodies: %u | Uploads: %.1f KB", counters.Entities, counters.Bodies, counters.UploadBytes / 1024.0);
+
+    // Last frame per phase; the selected one is graphed below
+    uint32_t phaseCount = Core::Telemetry::GetPhaseCount();
+    if (phaseCount == 0) return;
+    ImGui::Separator();
+    for (uint32_t p = 0; p < phaseCount; ++p) {
+        char label[96];
+        std::snprintf(label, sizeof(label), "%-28s %7.3f ms", Core::Telemetry::GetPhaseName(p).c_str(), last.PhaseMs[p]);
+        if (ImGui::Selectable(label, m_TelemetryPhase == p)) {
+            m_TelemetryPhase = p;
+        }
+    }
+
+    m_TelemetryPhase = std::min(m_TelemetryPhase, phaseCount - 1);
+    Core::Telemetry::Summary phaseSummary = Core::Telemetry::Summarize(m_TelemetryPhase);
+    PlotSource phaseSource{ first, m_TelemetryPhase };
+    ImGui::PlotLines(Core::Telemetry::GetPhaseName(m_TelemetryPhase).c_str(), getter, &phaseSource, samples,
+        0, nullptr, 0.0f, FLT_MAX, ImVec2(0, 60));
+    ImGui::Text("p50 %.3f | p95 %.3f | p99 %.3f ms", phaseSummary.P50, phaseSummary.P95, phaseSummary.P99);
+}
+
+void Engine::RecordTelemetry(double frameMs) {
+    Core::Telemetry::FrameCounters counters;
+    if (m_RenderSystem) {
+        const auto& stats = m_RenderSystem->GetStats();
+        const auto& gpuStats = m_RenderDevice->GetFrameStats();
+        counters.DrawCalls = gpuStats.drawCalls;
+        counters.Instances = stats.totalInstances;
+        counters.SkinnedInstances = stats.skinnedInstances;
+        counters.CulledInstances = stats.culledInstances;
+        counters.Lights = stats.pointLights;
+        counters.UploadBytes = gpuStats.uploadBytes;
+        counters.StagingBytes = gpuStats.stagingBytes;
+    }
+    if (m_Context.World) {
+        counters.Entities = static_cast<uint32_t>(m_Context.World->count<LocalTransform>());
+    }
+    if (m_PhysicsSystem) {
+        counters.Bodies = m_PhysicsSystem->GetBodyCount();
+    }
+    counters.HeapAllocations = m_FrameStats.HeapAllocations;
+    // Rewound at the start of this step, so this is the previous frame's usage
+    counters.FrameMemoryBytes = Core::FrameAllocator::GetStats().BytesUsed;
+
+    Core::Telemetry::EndFrame(frameMs, counters);
+
+    PROFILE_PLOT("Draw Calls", static_cast<int64_t>(counters.DrawCalls));
+    PROFILE_PLOT("Instances", static_cast<int64_t>(counters.Instances));
+    PROFILE_PLOT("Skinned Instances", static_cast<int64_t>(counters.SkinnedInstances));
+    PROFILE_PLOT("Lights", static_cast<int64_t>(counters.Lights));
+    PROFILE_PLOT("Bodies", static_cast<int64_t>(counters.Bodies));
+    PROFILE_PLOT("Upload Bytes", static_cast<int64_t>(counters.UploadBytes));
+    PROFILE_PLOT("Frame Memory Bytes", static_cast<int64_t>(counters.FrameMemoryBytes));
+}
+
+void Engine::WritePerfLog() {
+    std::filesystem::path csvPath(m_PerfLogPath);
+    std::filesystem::path jsonPath = csvPath;
+    jsonPath.replace_extension(".json");
+    if (jsonPath == csvPath) {
+        csvPath.replace_extension(".csv");
+    }
+
+    Core::Telemetry::Summary frame = Core::Telemetry::Summarize();
+    LOG_CORE_INFO("Frame time over {} frames: p50 {:.2f} ms | p95 {:.2f} ms | p99 {:.2f} ms | max {:.2f} ms",
+        Core::Telemetry::GetFrameCount(), frame.P50, frame.P95, frame.P99, frame.Max);
+
+    Core::Telemetry::WriteCsv(csvPath.string());
+    Core::Telemetry::WriteJson(jsonPath.string());
+}
+
+bool Engine::SetBenchmark(const std::string& scenarioPath, const std::string& reportPath) {
+    auto scenario = std::make_unique<Core::BenchmarkScenario>();
+    if (!Core::BenchmarkScenario::Load(scenarioPath, *scenario)) {
+        return false;
+    }
+
+    m_BenchmarkReportPath = reportPath.empty() ? "benchmark_" + scenario->Name + ".json" : reportPath;
+    if (!scenario->Spawn.IsEmpty()) {
+        SetStressScene(scenario->Spawn);
+    }
+    m_Benchmark = std::move(scenario);
+    return true;
+}
+
+bool Engine::UpdateBenchmark() {
+    const Core::BenchmarkScenario& scenario = *m_Benchmark;
+    flecs::world& world = *m_Context.World;
+
+    if (m_BenchmarkFrame == 0) {
+        // The flythrough camera takes over from the game's
+        world.each([](CameraComponent& camera) { camera.isPrimary = false; });
+        m_BenchmarkCamera = world.entity("BenchmarkCamera")
+            .set<LocalTransform>({})
+            .set<CameraComponent>({ scenario.Fov, 0.1f, 1000.0f, true });
+    }
+
+    if (m_BenchmarkFrame == scenario.WarmupFrames) {
+        // Only measured frames end up in the report
+        Core::Telemetry::Reset();
+    }
+    if (m_BenchmarkFrame == scenario.WarmupFrames + scenario.Frames) {
+        LOG_CORE_INFO("Benchmark '{}' finished", scenario.Name);
+        return false;
+    }
+
+    // Warm-up holds the first key; the measured frames cover the whole path
+    uint32_t measured = m_BenchmarkFrame > scenario.WarmupFrames ? m_BenchmarkFrame - scenario.WarmupFrames : 0;
+    float t = scenario.Frames > 1 ? static_cast<float>(measured) / (scenario.Frames - 1) : 0.0f;
+    Core::CameraSpline::Key key = scenario.Camera.Evaluate(t);
+    m_BenchmarkCamera.set<LocalTransform>({ key.position, CameraRotation(key.rotation.x, key.rotation.y, key.rotation.z), {1.0f, 1.0f, 1.0f} });
+
+    m_BenchmarkFrame++;
+    return true;
+}
+
+void Engine::WriteBenchmarkReport() {
+    uint32_t total = m_Benchmark->WarmupFrames + m_Benchmark->Frames;
+    if (m_BenchmarkFrame < total) {
+        LOG_CORE_WARN("Benchmark stopped after {} of {} frames, the report is incomplete", m_BenchmarkFrame, total);
+    }
+
+    Core::BenchmarkRun run;
+    run.Driver = m_RenderDevice ? m_RenderDevice->GetDriverName() : "none";
+    run.Headless = m_Headless;
+    run.Pipelined = m_PipelinedRendering;
+    run.Threads = m_JobSystem ? m_JobSystem->GetThreadCount() : 0;
+    Core::WriteBenchmarkReport(m_BenchmarkReportPath, *m_Benchmark, run);
+}
+
 void Engine::UpdateFPSCounter(float deltaTime) {
     m_FrameCount++;
     m_FPSAccumulator += deltaTime;
@@ -349,6 +708,14 @@ void Engine::RenderDebugMenu() {
             ImGui::Text("Draw Calls: %u", stats.drawCalls);
             ImGui::Text("Total Instances: %u", stats.totalInstances);
             ImGui::Text("Batched: %u | Skinned: %u", stats.batchedInstances, stats.skinnedInstances);
+            ImGui::Text("Culled: %u camera | %u shadow", stats.culledInstances, stats.shadowCulledInstances);
+
+            const auto& gpuStats = m_RenderDevice->GetFrameStats();
+            ImGui::Text("GPU: %u draws, %u passes, %u binds", gpuStats.drawCalls, gpuStats.renderPasses, gpuStats.pipelineBinds);
+            ImGui::Text("Uploads: %.1f KB | Uniforms: %.1f KB",
+                        gpuStats.uploadBytes / 1024.0, gpuStats.uniformBytes / 1024.0);
+            ImGui::Text("Staged: %.1f KB of a %.1f MB ring",
+                        gpuStats.stagingBytes / 1024.0, m_RenderDevice->GetStagingCapacity() / (1024.0 * 1024.0));
             ImGui::Separator();
         }
         
@@ -452,6 +819,48 @@ void Engine::RenderDebugMenu() {
             }
         }
         
+        // Frame pipeline (simulation vs. render overlap)
+        if (m_RenderSystem && ImGui::CollapsingHeader("Frame Pipeline")) {
+            bool pipelined = m_PipelinedRendering;
+            if (ImGui::Checkbox("Pipelined Rendering", &pipelined)) {
+                SetPipelinedRendering(pipelined);
+            }
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Simulate the next frame on the job system while this one is recorded. Adds a frame of latency.");
+            }
+            int tickRate = static_cast<int>(std::lround(GetFixedTickRate()));
+            if (ImGui::SliderInt("Tick Rate (Hz)", &tickRate, static_cast<int>(Core::TimeStep::MinTickRate), static_cast<int>(Core::TimeStep::MaxTickRate))) {
+                SetFixedTickRate(tickRate);
+            }
+            if (ImGui::IsItemHovered()) {
+                ImGui::SetTooltip("Fixed simulation rate. Rendering interpolates between ticks.");
+            }
+            ImGui::Text("Frame: %.2f ms | Latency: %.2f ms", m_FrameStats.FrameMs, m_FrameStats.LatencyMs);
+            ImGui::Text("Simulation: %.2f ms | Render: %.2f ms", m_FrameStats.SimulationMs, m_FrameStats.RenderMs);
+            if (m_PipelinedRendering) {
+                // Whatever the main thread didn't wait for ran in the shadow of rendering
+                double hidden = std::max(0.0, m_FrameStats.SimulationMs - m_FrameStats.WaitMs);
+                ImGui::Text("Waiting: %.2f ms | Overlapped: %.2f ms", m_FrameStats.WaitMs, hidden);
+            }
+
+            Core::FrameAllocator::Stats frameMemory = Core::FrameAllocator::GetStats();
+            ImGui::Text("Frame Memory: %.1f KB used | %.1f KB reserved (%u arenas)",
+                frameMemory.BytesUsed / 1024.0, frameMemory.BytesReserved / 1024.0, frameMemory.Arenas);
+            if (Core::AllocationTracker::IsEnabled()) {
+                ImGui::Text("Heap Allocations: %llu this frame", static_cast<unsigned long long>(m_FrameStats.HeapAllocations));
+            }
+        }
+        
+        // Recent frames from the telemetry ring
+        if (ImGui::CollapsingHeader("Telemetry")) {
+            RenderTelemetryUI();
+        }
+
+        // Per-system timings from the scheduler
+        if (m_Scheduler && ImGui::CollapsingHeader("Scheduler")) {
+            m_Scheduler->DrawDebugUI();
+        }
+        
         // Engine info
         if (ImGui::CollapsingHeader("Engine Info")) {
             ImGui::Text("Total Time: %.2f s", m_TotalTime);
@@ -498,7 +907,7 @@ void Engine::LoadConfig() {
         file >> config;
         
         // HDR settings
-        if (config.contains("hdr")) {
+        if (m_RenderDevice && config.contains("hdr")) {
             auto& hdr = config["hdr"];
             if (hdr.contains("exposure")) m_RenderDevice->SetExposure(hdr["exposure"]);
             if (hdr.contains("gamma")) m_RenderDevice->SetGamma(hdr["gamma"]);
@@ -508,7 +917,7 @@ void Engine::LoadConfig() {
         }
         
         // Bloom settings
-        if (config.contains("bloom")) {
+        if (m_RenderDevice && config.contains("bloom")) {
             auto& bloom = config["bloom"];
             if (bloom.contains("enabled")) m_RenderDevice->SetBloomEnabled(bloom["enabled"]);
             if (bloom.contains("threshold")) m_RenderDevice->SetBloomThreshold(bloom["threshold"]);
@@ -516,6 +925,24 @@ void Engine::LoadConfig() {
             if (bloom.contains("blurPasses")) m_RenderDevice->SetBloomBlurPasses(bloom["blurPasses"]);
         }
         
+        // Render settings
+        if (config.contains("render")) {
+            auto& render = config["render"];
+            if (render.contains("pipelined")) SetPipelinedRendering(render["pipelined"]);
+        }
+        
+        // Simulation settings
+        if (config.contains("simulation")) {
+            auto& simulation = config["simulation"];
+            if (simulation.contains("tickRate")) SetFixedTickRate(simulation["tickRate"].get<double>());
+        }
+        
+        // Physics settings
+        if (config.contains("physics")) {
+            auto& physics = config["physics"];
+            if (physics.contains("threads")) m_PhysicsSystem->SetThreadCount(physics["threads"].get<uint32_t>());
+        }
+        
         // Debug settings
         if (config.contains("debug")) {
             auto& debug = config["debug"];
@@ -548,6 +975,21 @@ void Engine::SaveConfig() {
         {"blurPasses", m_RenderDevice->GetBloomBlurPasses()}
     };
     
+    // Render settings
+    config["render"] = {
+        {"pipelined", m_PipelinedRendering}
+    };
+    
+    // Simulation settings
+    config["simulation"] = {
+        {"tickRate", GetFixedTickRate()}
+    };
+    
+    // Physics settings (0 = all worker threads)
+    config["physics"] = {
+        {"threads", m_PhysicsSystem->GetThreadCount()}
+    };
+    
     // Debug settings
     config["debug"] = {
         {"showFPS", m_ShowFPS},
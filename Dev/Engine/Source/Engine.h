@@ -1,7 +1,13 @@
 #pragma once
 
+#include "Core/Benchmark.h"
+#include "Scene/StressScene.h"
 #include "Core/Context.h"
 #include "Core/EventBus.h"
+#include "Core/FlecsProfiler.h"
+#include "Core/JobSystem.h"
+#include "Core/SystemScheduler.h"
+#include "Core/TimeStep.h"
 #include "Platform/Window.h"
 #include "Platform/Input.h"
 #include "Platform/RenderDevice.h"
@@ -9,6 +15,7 @@
 #include "Scene/SceneManager.h"
 #include <flecs.h>
 #include <memory>
+#include <string>
 
 #include "Systems/AbilitySystem.h"
 #include "Systems/RenderSystem.h"
@@ -43,12 +50,63 @@ public:
 
     void SetTimeLimit(double seconds) { m_TimeLimit = seconds; }
 
+    // On Shutdown(), write the telemetry of the recorded frames to `path` (per-frame CSV) and to the
+    // same path with a .json extension (p50/p95/p99 summaries). Empty disables.
+    void SetPerfLogPath(const std::string& path) { m_PerfLogPath = path; }
+
+    // Benchmark mode: once the game module is loaded, fly the scenario's camera with the simulated clock
+    // and vsync off, stop after its frames and write a report to `reportPath` (JSON, plus a per-frame CSV)
+    // on Shutdown(). Must be set before Init(); returns false if the scenario can't be loaded.
+    bool SetBenchmark(const std::string& scenarioPath, const std::string& reportPath);
+    bool IsBenchmarking() const { return m_Benchmark != nullptr; }
+
+    // Generated at the start of the first Step(), after the game module's GameInit, so the load adds
+    // to the game's own scene. A benchmark scenario with a spawn block sets this too; the last call wins.
+    void SetStressScene(const Core::StressSceneSettings& settings) { m_StressScene = std::make_unique<Core::StressSceneSettings>(settings); }
+
+    // Headless: no window, GPU device, ImGui or RenderSystem. Must be set before Init().
+    void SetHeadless(bool headless) { m_Headless = headless; }
+    bool IsHeadless() const { return m_Headless; }
+
+    // Headless only: run RenderSystem every frame against the null RenderDevice backend, so the
+    // CPU side of rendering can be profiled without a GPU. Must be set before Init().
+    void SetNullRenderer(bool nullRenderer) { m_NullRenderer = nullRenderer; }
+
+    // Each Step() advances exactly one fixed tick instead of following the wall clock,
+    // so the simulation runs as fast as the CPU allows
+    void SetSimulatedClock(bool simulated) { m_SimulatedClock = simulated; }
+
+    // Fixed simulation rate in Hz (gameplay, physics, animation). Rendering is decoupled from it and
+    // interpolates between the last two ticks, so it can be lowered without visible stepping.
+    void SetFixedTickRate(double hz);
+    double GetFixedTickRate() const { return 1.0 / m_FixedDeltaTime; }
+
+    // Pipelined rendering: while the main thread records and submits frame N from its render snapshot,
+    // the job system simulates and extracts frame N+1. Trades one frame of latency for throughput.
+    // Can be switched between steps.
+    void SetPipelinedRendering(bool pipelined) { m_PipelinedRendering = pipelined; }
+    bool IsPipelinedRendering() const { return m_PipelinedRendering; }
+
+    // Moving averages in milliseconds
+    struct FrameStats {
+        double FrameMs = 0.0;      // Whole Step()
+        double SimulationMs = 0.0; // Fixed ticks + snapshot extraction
+        double RenderMs = 0.0;     // Recording and submitting a snapshot
+        double WaitMs = 0.0;       // Pipelined only: main thread waiting for the simulation after rendering
+        double LatencyMs = 0.0;    // Snapshot extraction to submit
+        uint64_t HeapAllocations = 0; // Last frame, not averaged. Always 0 unless built with OAKEN_TRACK_ALLOCATIONS.
+    };
+    const FrameStats& GetFrameStats() const { return m_FrameStats; }
+
     Core::GameContext& GetContext() { return m_Context; }
     Resources::ResourceManager& GetResourceManager() { return *m_ResourceManager; }
 
 private:
     void Update(double dt);
-    void Render(double alpha);
+    void Simulate(uint32_t ticks, double alpha, Systems::RenderSnapshot* snapshot);
+    void Render(const Systems::RenderSnapshot& snapshot, bool drawUI);
+    void BuildSchedule();
+    static void AccumulateFrameStat(double& average, double ms);
 
     std::unique_ptr<Platform::Window> m_Window;
     std::unique_ptr<Platform::Input> m_Input;
@@ -56,6 +114,9 @@ private:
     std::unique_ptr<Resources::ResourceManager> m_ResourceManager;
     std::unique_ptr<Core::SceneManager> m_SceneManager;
     std::unique_ptr<Core::EventBus> m_EventBus;
+    std::unique_ptr<Core::JobSystem> m_JobSystem;
+    std::unique_ptr<Core::SystemScheduler> m_Scheduler;
+    Core::FlecsProfiler m_FlecsProfiler;
     
     Core::GameContext m_Context;
     
@@ -63,6 +124,7 @@ private:
     double m_Accumulator = 0.0;
     double m_CurrentTime = 0.0;
     double m_TotalTime = 0.0;
+    double m_FixedDeltaTime = Core::TimeStep::FixedDeltaTime;
 
     // Systems
     std::unique_ptr<Systems::AbilitySystem> m_AbilitySystem;
@@ -76,15 +138,35 @@ private:
     std::unique_ptr<Systems::CharacterSystem> m_CharacterSystem;
 
     bool m_IsRunning = false;
+    bool m_Headless = false;
+    bool m_NullRenderer = false;
+    bool m_SimulatedClock = false;
+    bool m_PipelinedRendering = false;
     bool m_EditorMode = true;
     bool m_DebugPhysics = true;  // Draw physics colliders
     double m_TimeLimit = 0.0;
+    std::string m_PerfLogPath;
+
+    // Benchmark mode
+    std::unique_ptr<Core::BenchmarkScenario> m_Benchmark;
+    std::string m_BenchmarkReportPath;
+    uint32_t m_BenchmarkFrame = 0; // Steps taken, warm-up included
+    flecs::entity m_BenchmarkCamera;
+
+    std::unique_ptr<Core::StressSceneSettings> m_StressScene; // Pending until the first Step()
+
+    // Render snapshots: one is recorded while the simulation fills the other
+    Systems::RenderSnapshot m_Snapshots[2];
+    uint32_t m_SnapshotIndex = 0; // Snapshot the next frame records
+    bool m_SnapshotReady = false; // Pipelined: m_Snapshots[m_SnapshotIndex] was produced by the last step
+    FrameStats m_FrameStats;
 
     // Debug UI state
     bool m_ShowDebugMenu = false;
     bool m_ShowColliders = true;
     bool m_ShowSkeleton = true;
     bool m_ShowFPS = true;
+    uint32_t m_TelemetryPhase = 0; // Graphed in the Telemetry panel
     
     // FPS tracking
     float m_FPSAccumulator = 0.0f;
@@ -94,6 +176,11 @@ private:
     void InitImGui();
     void ShutdownImGui();
     void RenderDebugMenu();
+    void RenderTelemetryUI();
+    void RecordTelemetry(double frameMs);
+    void WritePerfLog();
+    bool UpdateBenchmark(); // False once the scenario has run all its frames
+    void WriteBenchmarkReport();
     void HandleDebugInput();
     void UpdateFPSCounter(float deltaTime);
     
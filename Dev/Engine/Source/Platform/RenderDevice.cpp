@@ -1,9 +1,17 @@
 #include "RenderDevice.h"
 #include "Window.h"
-#include <iostream>
+#include "../Core/Log.h"
+#include <algorithm>
 
 namespace Platform {
 
+    namespace {
+        // The staging ring starts at this size and doubles when a frame's uploads don't fit
+        constexpr uint32_t StagingRingSize = 4u << 20;
+        constexpr uint32_t BufferUploadAlignment = 16;
+        constexpr uint32_t TextureUploadAlignment = 512;  // D3D12's texture placement alignment
+    }
+
     RenderDevice::RenderDevice() {}
 
     RenderDevice::~RenderDevice() {
@@ -17,14 +25,14 @@ namespace Platform {
         m_Device = SDL_CreateGPUDevice(SDL_GPU_SHADERFORMAT_SPIRV, true, nullptr);
         
         if (!m_Device) {
-            std::cerr << "SDL_CreateGPUDevice Error: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("SDL_CreateGPUDevice Error: {}", SDL_GetError());
             return false;
         }
 
-        std::cout << "GPU Driver: " << SDL_GetGPUDeviceDriver(m_Device) << std::endl;
+        LOG_CORE_INFO("GPU Driver: {}", SDL_GetGPUDeviceDriver(m_Device));
 
         if (!SDL_ClaimWindowForGPUDevice(m_Device, m_Window->GetNativeWindow())) {
-            std::cerr << "SDL_ClaimWindowForGPUDevice Error: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("SDL_ClaimWindowForGPUDevice Error: {}", SDL_GetError());
             return false;
         }
 
@@ -34,80 +42,147 @@ namespace Platform {
         return true;
     }
 
+    bool RenderDevice::InitNull(uint32_t width, uint32_t height) {
+        if (width == 0 || height == 0) {
+            LOG_CORE_ERROR("RenderDevice::InitNull: invalid size {}x{}", width, height);
+            return false;
+        }
+
+        m_Backend = RenderBackend::Null;
+        m_Window = nullptr;
+        m_NullWidth = width;
+        m_NullHeight = height;
+        m_NullSwapchainTexture = CreateNullHandle<SDL_GPUTexture>();
+
+        LOG_CORE_INFO("GPU Driver: null ({}x{})", width, height);
+
+        CreateShadowMapTexture(m_ShadowMapSize);
+
+        return true;
+    }
+
     SDL_GPUTextureFormat RenderDevice::GetSwapchainTextureFormat() const {
+        if (IsNull()) {
+            return SDL_GPU_TEXTUREFORMAT_B8G8R8A8_UNORM;
+        }
         return SDL_GetGPUSwapchainTextureFormat(m_Device, m_Window->GetNativeWindow());
     }
 
+    const char* RenderDevice::GetDriverName() const {
+        if (IsNull()) {
+            return "null";
+        }
+        return m_Device ? SDL_GetGPUDeviceDriver(m_Device) : "";
+    }
+
+    float RenderDevice::GetAspectRatio() const {
+        if (m_Window) {
+            return m_Window->GetAspectRatio();
+        }
+        return m_RenderHeight > 0 ? static_cast<float>(m_RenderWidth) / static_cast<float>(m_RenderHeight) : 1.0f;
+    }
+
+    bool RenderDevice::SetVSync(bool enabled) {
+        if (IsNull() || !m_Device) {
+            return true;
+        }
+
+        SDL_Window* window = m_Window->GetNativeWindow();
+        SDL_GPUPresentMode mode = SDL_GPU_PRESENTMODE_VSYNC;
+        if (!enabled) {
+            if (SDL_WindowSupportsGPUPresentMode(m_Device, window, SDL_GPU_PRESENTMODE_MAILBOX)) {
+                mode = SDL_GPU_PRESENTMODE_MAILBOX;
+            } else if (SDL_WindowSupportsGPUPresentMode(m_Device, window, SDL_GPU_PRESENTMODE_IMMEDIATE)) {
+                mode = SDL_GPU_PRESENTMODE_IMMEDIATE;
+            } else {
+                LOG_CORE_WARN("RenderDevice: window can only present with vsync");
+                return false;
+            }
+        }
+
+        if (!SDL_SetGPUSwapchainParameters(m_Device, window, SDL_GPU_SWAPCHAINCOMPOSITION_SDR, mode)) {
+            LOG_CORE_ERROR("SDL_SetGPUSwapchainParameters Error: {}", SDL_GetError());
+            return false;
+        }
+        return true;
+    }
+
     void RenderDevice::Shutdown() {
-        if (m_Device) {
+        if (m_Device || IsNull()) {
             if (m_ShadowSampler) {
-                SDL_ReleaseGPUSampler(m_Device, m_ShadowSampler);
+                ReleaseSampler(m_ShadowSampler);
                 m_ShadowSampler = nullptr;
             }
             if (m_ShadowMapTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_ShadowMapTexture);
+                ReleaseTexture(m_ShadowMapTexture);
                 m_ShadowMapTexture = nullptr;
             }
             if (m_DepthSampler) {
-                SDL_ReleaseGPUSampler(m_Device, m_DepthSampler);
+                ReleaseSampler(m_DepthSampler);
                 m_DepthSampler = nullptr;
             }
             if (m_TileLightIndicesBuffer) {
-                SDL_ReleaseGPUBuffer(m_Device, m_TileLightIndicesBuffer);
+                ReleaseBuffer(m_TileLightIndicesBuffer);
                 m_TileLightIndicesBuffer = nullptr;
             }
             if (m_LightBuffer) {
-                SDL_ReleaseGPUBuffer(m_Device, m_LightBuffer);
+                ReleaseBuffer(m_LightBuffer);
                 m_LightBuffer = nullptr;
             }
             if (m_BloomBrightTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_BloomBrightTexture);
+                ReleaseTexture(m_BloomBrightTexture);
                 m_BloomBrightTexture = nullptr;
             }
             if (m_BloomBlurTextureA) {
-                SDL_ReleaseGPUTexture(m_Device, m_BloomBlurTextureA);
+                ReleaseTexture(m_BloomBlurTextureA);
                 m_BloomBlurTextureA = nullptr;
             }
             if (m_BloomBlurTextureB) {
-                SDL_ReleaseGPUTexture(m_Device, m_BloomBlurTextureB);
+                ReleaseTexture(m_BloomBlurTextureB);
                 m_BloomBlurTextureB = nullptr;
             }
             if (m_HDRTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_HDRTexture);
+                ReleaseTexture(m_HDRTexture);
                 m_HDRTexture = nullptr;
             }
             if (m_DepthTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_DepthTexture);
+                ReleaseTexture(m_DepthTexture);
                 m_DepthTexture = nullptr;
             }
             // Release SSGI textures
             if (m_SSGITexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_SSGITexture);
+                ReleaseTexture(m_SSGITexture);
                 m_SSGITexture = nullptr;
             }
             if (m_SSGIHistoryTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_SSGIHistoryTexture);
+                ReleaseTexture(m_SSGIHistoryTexture);
                 m_SSGIHistoryTexture = nullptr;
             }
             if (m_SSGIDenoiseTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_SSGIDenoiseTexture);
+                ReleaseTexture(m_SSGIDenoiseTexture);
                 m_SSGIDenoiseTexture = nullptr;
             }
             if (m_NoiseTexture) {
-                SDL_ReleaseGPUTexture(m_Device, m_NoiseTexture);
+                ReleaseTexture(m_NoiseTexture);
                 m_NoiseTexture = nullptr;
             }
-            if (m_Window) {
-                SDL_ReleaseWindowFromGPUDevice(m_Device, m_Window->GetNativeWindow());
+            ReleaseStaging();
+            if (m_Device) {
+                if (m_Window) {
+                    SDL_ReleaseWindowFromGPUDevice(m_Device, m_Window->GetNativeWindow());
+                }
+                SDL_DestroyGPUDevice(m_Device);
+                m_Device = nullptr;
             }
-            SDL_DestroyGPUDevice(m_Device);
-            m_Device = nullptr;
+            m_NullTransferMemory.clear();
+            m_NullSwapchainTexture = nullptr;
+            m_Backend = RenderBackend::SDL;
         }
     }
 
     void RenderDevice::CreateDepthTexture(uint32_t width, uint32_t height) {
         if (m_DepthTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_DepthTexture);
+            ReleaseTexture(m_DepthTexture);
         }
 
         SDL_GPUTextureCreateInfo createInfo = {};
@@ -120,12 +195,12 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
 
-        m_DepthTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_DepthTexture = CreateTexture(&createInfo);
     }
 
     void RenderDevice::CreateHDRTexture(uint32_t width, uint32_t height) {
         if (m_HDRTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_HDRTexture);
+            ReleaseTexture(m_HDRTexture);
         }
 
         SDL_GPUTextureCreateInfo createInfo = {};
@@ -138,9 +213,9 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
 
-        m_HDRTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_HDRTexture = CreateTexture(&createInfo);
         if (m_HDRTexture) {
-            std::cout << "HDR Texture created: " << width << "x" << height << " (RGBA16F)" << std::endl;
+            LOG_CORE_INFO("HDR Texture created: {}x{} (RGBA16F)", width, height);
         }
     }
 
@@ -151,13 +226,13 @@ namespace Platform {
         
         // Release existing textures
         if (m_BloomBrightTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_BloomBrightTexture);
+            ReleaseTexture(m_BloomBrightTexture);
         }
         if (m_BloomBlurTextureA) {
-            SDL_ReleaseGPUTexture(m_Device, m_BloomBlurTextureA);
+            ReleaseTexture(m_BloomBlurTextureA);
         }
         if (m_BloomBlurTextureB) {
-            SDL_ReleaseGPUTexture(m_Device, m_BloomBlurTextureB);
+            ReleaseTexture(m_BloomBlurTextureB);
         }
         
         SDL_GPUTextureCreateInfo createInfo = {};
@@ -170,15 +245,15 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
         
-        m_BloomBrightTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
-        m_BloomBlurTextureA = SDL_CreateGPUTexture(m_Device, &createInfo);
-        m_BloomBlurTextureB = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_BloomBrightTexture = CreateTexture(&createInfo);
+        m_BloomBlurTextureA = CreateTexture(&createInfo);
+        m_BloomBlurTextureB = CreateTexture(&createInfo);
         
         m_BloomWidth = bloomWidth;
         m_BloomHeight = bloomHeight;
         
         if (m_BloomBrightTexture && m_BloomBlurTextureA && m_BloomBlurTextureB) {
-            std::cout << "Bloom textures created: " << bloomWidth << "x" << bloomHeight << " (RGBA16F)" << std::endl;
+            LOG_CORE_INFO("Bloom textures created: {}x{} (RGBA16F)", bloomWidth, bloomHeight);
         }
     }
 
@@ -189,13 +264,13 @@ namespace Platform {
         
         // Release existing textures
         if (m_SSGITexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_SSGITexture);
+            ReleaseTexture(m_SSGITexture);
         }
         if (m_SSGIHistoryTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_SSGIHistoryTexture);
+            ReleaseTexture(m_SSGIHistoryTexture);
         }
         if (m_SSGIDenoiseTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_SSGIDenoiseTexture);
+            ReleaseTexture(m_SSGIDenoiseTexture);
         }
         
         SDL_GPUTextureCreateInfo createInfo = {};
@@ -208,16 +283,16 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
         
-        m_SSGITexture = SDL_CreateGPUTexture(m_Device, &createInfo);
-        m_SSGIHistoryTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
-        m_SSGIDenoiseTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_SSGITexture = CreateTexture(&createInfo);
+        m_SSGIHistoryTexture = CreateTexture(&createInfo);
+        m_SSGIDenoiseTexture = CreateTexture(&createInfo);
         
         m_SSGIWidth = ssgiWidth;
         m_SSGIHeight = ssgiHeight;
         m_SSGIWasReset = true;  // Signal that history buffer is invalid
         
         if (m_SSGITexture && m_SSGIHistoryTexture && m_SSGIDenoiseTexture) {
-            std::cout << "SSGI textures created: " << ssgiWidth << "x" << ssgiHeight << " (RGBA16F)" << std::endl;
+            LOG_CORE_INFO("SSGI textures created: {}x{} (RGBA16F)", ssgiWidth, ssgiHeight);
         }
     }
 
@@ -226,7 +301,7 @@ namespace Platform {
         const uint32_t noiseSize = 64;
         
         if (m_NoiseTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_NoiseTexture);
+            ReleaseTexture(m_NoiseTexture);
         }
         
         SDL_GPUTextureCreateInfo createInfo = {};
@@ -239,7 +314,7 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
         
-        m_NoiseTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_NoiseTexture = CreateTexture(&createInfo);
         
         if (m_NoiseTexture) {
             // Generate blue noise pattern (using interleaved gradient noise)
@@ -258,54 +333,34 @@ namespace Platform {
                 }
             }
             
-            // Upload noise data to GPU
-            SDL_GPUTransferBufferCreateInfo transferInfo = {};
-            transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferInfo.size = noiseData.size();
+            // Upload noise data to GPU (with this frame's other uploads)
+            SDL_GPUTextureRegion dstRegion = {};
+            dstRegion.texture = m_NoiseTexture;
+            dstRegion.w = noiseSize;
+            dstRegion.h = noiseSize;
+            dstRegion.d = 1;
+            UploadTexture(dstRegion, noiseData.data(), static_cast<uint32_t>(noiseData.size()));
             
-            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_Device, &transferInfo);
-            if (transferBuffer) {
-                void* map = SDL_MapGPUTransferBuffer(m_Device, transferBuffer, false);
-                memcpy(map, noiseData.data(), noiseData.size());
-                SDL_UnmapGPUTransferBuffer(m_Device, transferBuffer);
-                
-                SDL_GPUCommandBuffer* uploadCmd = SDL_AcquireGPUCommandBuffer(m_Device);
-                SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(uploadCmd);
-                
-                SDL_GPUTextureTransferInfo srcInfo = {};
-                srcInfo.transfer_buffer = transferBuffer;
-                srcInfo.offset = 0;
-                
-                SDL_GPUTextureRegion dstRegion = {};
-                dstRegion.texture = m_NoiseTexture;
-                dstRegion.w = noiseSize;
-                dstRegion.h = noiseSize;
-                dstRegion.d = 1;
-                
-                SDL_UploadToGPUTexture(copyPass, &srcInfo, &dstRegion, false);
-                
-                SDL_EndGPUCopyPass(copyPass);
-                SDL_SubmitGPUCommandBuffer(uploadCmd);
-                
-                SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
-            }
-            
-            std::cout << "SSGI noise texture created: " << noiseSize << "x" << noiseSize << std::endl;
+            LOG_CORE_INFO("SSGI noise texture created: {}x{}", noiseSize, noiseSize);
         }
     }
 
     void RenderDevice::BeginFrame() {
         m_FrameValid = false;  // Reset at start of frame
         
-        m_CommandBuffer = SDL_AcquireGPUCommandBuffer(m_Device);
+        m_CommandBuffer = AcquireCommandBuffer();
         if (!m_CommandBuffer) {
-            std::cerr << "BeginFrame: Failed to acquire command buffer!" << std::endl;
+            LOG_CORE_ERROR("BeginFrame: Failed to acquire command buffer!");
             return;
         }
 
         uint32_t w, h;
-        if (!SDL_AcquireGPUSwapchainTexture(m_CommandBuffer, m_Window->GetNativeWindow(), &m_SwapchainTexture, &w, &h)) {
-            std::cerr << "BeginFrame: Failed to acquire swapchain texture: " << SDL_GetError() << std::endl;
+        if (IsNull()) {
+            m_SwapchainTexture = m_NullSwapchainTexture;
+            w = m_NullWidth;
+            h = m_NullHeight;
+        } else if (!SDL_AcquireGPUSwapchainTexture(m_CommandBuffer, m_Window->GetNativeWindow(), &m_SwapchainTexture, &w, &h)) {
+            LOG_CORE_ERROR("BeginFrame: Failed to acquire swapchain texture: {}", SDL_GetError());
             return;
         }
 
@@ -374,13 +429,13 @@ namespace Platform {
         depthStencilInfo.stencil_store_op = SDL_GPU_STOREOP_STORE;
         depthStencilInfo.cycle = true; // Important if we reuse the texture
 
-        m_RenderPass = SDL_BeginGPURenderPass(m_CommandBuffer, &colorTargetInfo, 1, &depthStencilInfo);
+        m_RenderPass = BeginRenderPass(m_CommandBuffer, &colorTargetInfo, 1, &depthStencilInfo);
         return m_RenderPass != nullptr;
     }
 
     void RenderDevice::EndRenderPass() {
         if (m_RenderPass) {
-            SDL_EndGPURenderPass(m_RenderPass);
+            EndRenderPass(m_RenderPass);
             m_RenderPass = nullptr;
         }
     }
@@ -397,23 +452,49 @@ namespace Platform {
         colorTargetInfo.load_op = SDL_GPU_LOADOP_DONT_CARE;  // We're overwriting everything
         colorTargetInfo.store_op = SDL_GPU_STOREOP_STORE;
         
-        m_RenderPass = SDL_BeginGPURenderPass(m_CommandBuffer, &colorTargetInfo, 1, nullptr);
+        m_RenderPass = BeginRenderPass(m_CommandBuffer, &colorTargetInfo, 1, nullptr);
         if (!m_RenderPass) {
-            std::cerr << "BeginToneMappingPass: SDL_BeginGPURenderPass failed: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("BeginToneMappingPass: SDL_BeginGPURenderPass failed: {}", SDL_GetError());
         }
         return m_RenderPass != nullptr;
     }
 
     void RenderDevice::EndFrame() {
         if (m_RenderPass) {
-            SDL_EndGPURenderPass(m_RenderPass);
+            EndRenderPass(m_RenderPass);
             m_RenderPass = nullptr;
         }
 
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
         if (m_CommandBuffer) {
-            SDL_SubmitGPUCommandBuffer(m_CommandBuffer);
+            // The fence tells the staging ring when the GPU is done with this frame's uploads
+            if (m_StagingFlushed > m_StagingFenced && !IsNull()) {
+                SDL_GPUFence* fence = SDL_SubmitGPUCommandBufferAndAcquireFence(m_CommandBuffer);
+                if (fence) {
+                    m_StagingFences.push_back({ fence, m_StagingFlushed });
+                } else {
+                    LOG_CORE_ERROR("EndFrame: submit failed: {}", SDL_GetError());
+                    m_StagingTail = m_StagingFlushed;
+                }
+            } else {
+                SubmitCommandBuffer(m_CommandBuffer);
+            }
+            if (IsNull()) {
+                m_StagingTail = m_StagingFlushed;  // Nothing ever reads it
+            }
+            m_StagingFenced = m_StagingFlushed;
             m_CommandBuffer = nullptr;
         }
+        RetireStaging(false);
+        m_FrameStats.stagingBytes = m_StagedBytes;
+        m_StagedBytes = 0;
+
+        // Publish this frame's counters. Work issued between frames (resource uploads) counts
+        // towards the next one.
+        m_LastFrameStats = m_FrameStats;
+        m_FrameStats = {};
+        m_LastFrameCommands.swap(m_Commands);
+        m_Commands.clear();
     }
 
     SDL_GPUTexture* RenderDevice::CreateTexture(uint32_t width, uint32_t height, const void* data) {
@@ -428,57 +509,225 @@ namespace Platform {
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
         createInfo.props = 0;
 
-        SDL_GPUTexture* texture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        SDL_GPUTexture* texture = CreateTexture(&createInfo);
         
         if (data && texture) {
-            // Create transfer buffer
-            uint32_t size = width * height * 4;
-            SDL_GPUTransferBufferCreateInfo transferInfo;
-            transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferInfo.size = size;
-            transferInfo.props = 0;
-
-            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_Device, &transferInfo);
-            
-            if (transferBuffer) {
-                void* map = SDL_MapGPUTransferBuffer(m_Device, transferBuffer, false);
-                if (map) {
-                    memcpy(map, data, size);
-                    SDL_UnmapGPUTransferBuffer(m_Device, transferBuffer);
-
-                    SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(m_Device);
-                    SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
-                    
-                    SDL_GPUTextureTransferInfo source;
-                    source.transfer_buffer = transferBuffer;
-                    source.offset = 0;
-                    source.pixels_per_row = width;
-                    source.rows_per_layer = height;
-
-                    SDL_GPUTextureRegion destination;
-                    destination.texture = texture;
-                    destination.mip_level = 0;
-                    destination.layer = 0;
-                    destination.x = 0;
-                    destination.y = 0;
-                    destination.z = 0;
-                    destination.w = width;
-                    destination.h = height;
-                    destination.d = 1;
-
-                    SDL_UploadToGPUTexture(copyPass, &source, &destination, false);
-                    SDL_EndGPUCopyPass(copyPass);
-                    SDL_SubmitGPUCommandBuffer(cmd);
-                    
-                    // Note: We should release transferBuffer, but we need to wait for command buffer to finish.
-                    // For simplicity in this prototype, we leak it or release it immediately (which is unsafe without fence).
-                    // SDL3 might handle this if we release it? 
-                    // "You can release the transfer buffer immediately after submitting the command buffer." - SDL3 docs usually say this for some resources.
-                    SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
+            SDL_GPUTextureRegion destination = {};
+            destination.texture = texture;
+            destination.w = width;
+            destination.h = height;
+            destination.d = 1;
+            UploadTexture(destination, data, width * height * 4);
+        }
+        return texture;
+    }
+
+    bool RenderDevice::UploadBuffer(SDL_GPUBuffer* buffer, uint32_t offset, const void* data, uint32_t size, bool cycle) {
+        if (!buffer) return false;
+        if (size == 0) return true;
+
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        PendingUpload upload;
+        uint8_t* memory = AllocateStaging(size, BufferUploadAlignment, upload.transferBuffer, upload.transferOffset);
+        if (!memory) return false;
+        memcpy(memory, data, size);
+
+        upload.kind = PendingUpload::Kind::Buffer;
+        upload.cycle = cycle;
+        upload.buffer = buffer;
+        upload.offset = offset;
+        upload.size = size;
+        m_PendingUploads.push_back(upload);
+        return true;
+    }
+
+    bool RenderDevice::UploadTexture(const SDL_GPUTextureRegion& region, const void* data, uint32_t size) {
+        if (!region.texture) return false;
+        if (size == 0) return true;
+
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        PendingUpload upload;
+        uint8_t* memory = AllocateStaging(size, TextureUploadAlignment, upload.transferBuffer, upload.transferOffset);
+        if (!memory) return false;
+        memcpy(memory, data, size);
+
+        upload.kind = PendingUpload::Kind::Texture;
+        upload.size = size;
+        upload.region = region;
+        m_PendingUploads.push_back(upload);
+        return true;
+    }
+
+    void RenderDevice::QueueBufferCopy(SDL_GPUBuffer* source, uint32_t sourceOffset, SDL_GPUBuffer* destination,
+                                       uint32_t destinationOffset, uint32_t size) {
+        if (!source || !destination || size == 0) return;
+
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        PendingUpload copy;
+        copy.kind = PendingUpload::Kind::Copy;
+        copy.source = source;
+        copy.sourceOffset = sourceOffset;
+        copy.buffer = destination;
+        copy.offset = destinationOffset;
+        copy.size = size;
+        m_PendingUploads.push_back(copy);
+    }
+
+    void RenderDevice::FlushUploads() {
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        if (m_PendingUploads.empty() || !m_CommandBuffer) return;
+
+        // The copy commands can't be recorded while their transfer buffer is mapped
+        if (m_StagingMap) {
+            UnmapTransferBuffer(m_StagingBuffer);
+            m_StagingMap = nullptr;
+        }
+
+        SDL_GPUCopyPass* copyPass = BeginCopyPass(m_CommandBuffer);
+        for (const PendingUpload& upload : m_PendingUploads) {
+            switch (upload.kind) {
+                case PendingUpload::Kind::Buffer: {
+                    SDL_GPUTransferBufferLocation source = { upload.transferBuffer, upload.transferOffset };
+                    SDL_GPUBufferRegion destination = { upload.buffer, upload.offset, upload.size };
+                    UploadToBuffer(copyPass, &source, &destination, upload.cycle);
+                    break;
+                }
+                case PendingUpload::Kind::Texture: {
+                    SDL_GPUTextureTransferInfo source = {};
+                    source.transfer_buffer = upload.transferBuffer;
+                    source.offset = upload.transferOffset;
+                    source.pixels_per_row = upload.region.w;
+                    source.rows_per_layer = upload.region.h;
+                    UploadToTexture(copyPass, &source, &upload.region, false);
+                    break;
+                }
+                case PendingUpload::Kind::Copy: {
+                    SDL_GPUBufferLocation source = { upload.source, upload.sourceOffset };
+                    SDL_GPUBufferLocation destination = { upload.buffer, upload.offset };
+                    CopyBufferToBuffer(copyPass, &source, &destination, upload.size, false);
+                    break;
                 }
             }
         }
-        return texture;
+        EndCopyPass(copyPass);
+
+        m_PendingUploads.clear();
+        m_StagingFlushed = m_StagingHead;
+    }
+
+    uint32_t RenderDevice::GetStagingCapacity() const {
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        return m_StagingCapacity;
+    }
+
+    uint8_t* RenderDevice::AllocateStaging(uint32_t size, uint32_t alignment, SDL_GPUTransferBuffer*& transferBuffer, uint32_t& offset) {
+        RetireStaging(false);
+        for (;;) {
+            if (m_StagingBuffer) {
+                uint64_t ringOffset = (m_StagingHead - m_StagingBase) % m_StagingCapacity;
+                uint64_t padding = (alignment - ringOffset % alignment) % alignment;
+                if (ringOffset + padding + size > m_StagingCapacity) {
+                    padding = m_StagingCapacity - ringOffset;  // Wrap around to the start
+                }
+                uint64_t used = m_StagingHead - std::max(m_StagingTail, m_StagingBase);
+                if (used + padding + size <= m_StagingCapacity) {
+                    if (!m_StagingMap) {
+                        m_StagingMap = static_cast<uint8_t*>(MapTransferBuffer(m_StagingBuffer, false));
+                        if (!m_StagingMap) {
+                            LOG_CORE_ERROR("Staging ring: map failed: {}", SDL_GetError());
+                            return nullptr;
+                        }
+                    }
+                    uint64_t start = m_StagingHead + padding;
+                    m_StagingHead = start + size;
+                    m_StagedBytes += size;
+                    transferBuffer = m_StagingBuffer;
+                    offset = static_cast<uint32_t>((start - m_StagingBase) % m_StagingCapacity);
+                    return m_StagingMap + offset;
+                }
+                // Full: wait for the oldest frame still reading from it, then try again
+                if (!m_StagingFences.empty()) {
+                    RetireStaging(true);
+                    continue;
+                }
+            }
+            // Everything left is waiting for the next flush, which needs a bigger ring
+            if (!GrowStaging(size)) return nullptr;
+        }
+    }
+
+    bool RenderDevice::GrowStaging(uint32_t size) {
+        uint64_t capacity = std::max<uint64_t>(StagingRingSize, uint64_t(m_StagingCapacity) * 2);
+        while (capacity < size) capacity *= 2;
+        if (capacity > UINT32_MAX) {
+            LOG_CORE_ERROR("Staging ring: no room for a {} byte upload", size);
+            return false;
+        }
+
+        SDL_GPUTransferBufferCreateInfo transferInfo = {};
+        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
+        transferInfo.size = static_cast<uint32_t>(capacity);
+        SDL_GPUTransferBuffer* transferBuffer = CreateTransferBuffer(&transferInfo);
+        if (!transferBuffer) {
+            LOG_CORE_ERROR("Staging ring: failed to create {} KB: {}", capacity / 1024, SDL_GetError());
+            return false;
+        }
+
+        // Queued uploads keep reading the old ring until their frame is done with it
+        if (m_StagingBuffer) {
+            if (m_StagingMap) {
+                UnmapTransferBuffer(m_StagingBuffer);
+                m_StagingMap = nullptr;
+            }
+            m_RetiredStaging.push_back({ m_StagingBuffer, m_StagingHead });
+        }
+        m_StagingBuffer = transferBuffer;
+        m_StagingCapacity = static_cast<uint32_t>(capacity);
+        m_StagingBase = m_StagingHead;
+        LOG_CORE_INFO("Staging ring: {} KB", capacity / 1024);
+        return true;
+    }
+
+    void RenderDevice::RetireStaging(bool wait) {
+        if (wait && !m_StagingFences.empty()) {
+            SDL_WaitForGPUFences(m_Device, true, &m_StagingFences.front().fence, 1);
+        }
+        while (!m_StagingFences.empty()) {
+            StagingFence& oldest = m_StagingFences.front();
+            if (!SDL_QueryGPUFence(m_Device, oldest.fence)) break;
+            SDL_ReleaseGPUFence(m_Device, oldest.fence);
+            m_StagingTail = std::max(m_StagingTail, oldest.end);
+            m_StagingFences.pop_front();
+        }
+        std::erase_if(m_RetiredStaging, [this](const RetiredStaging& retired) {
+            if (retired.end > m_StagingTail) return false;
+            ReleaseTransferBuffer(retired.transferBuffer);
+            return true;
+        });
+    }
+
+    void RenderDevice::ReleaseStaging() {
+        std::lock_guard<std::mutex> lock(m_StagingMutex);
+        for (const StagingFence& pending : m_StagingFences) {
+            SDL_ReleaseGPUFence(m_Device, pending.fence);
+        }
+        m_StagingFences.clear();
+        for (const RetiredStaging& retired : m_RetiredStaging) {
+            ReleaseTransferBuffer(retired.transferBuffer);
+        }
+        m_RetiredStaging.clear();
+        if (m_StagingBuffer) {
+            if (m_StagingMap) {
+                UnmapTransferBuffer(m_StagingBuffer);
+            }
+            ReleaseTransferBuffer(m_StagingBuffer);
+        }
+        m_StagingBuffer = nullptr;
+        m_StagingMap = nullptr;
+        m_StagingCapacity = 0;
+        m_StagingBase = m_StagingHead = m_StagingTail = 0;
+        m_StagingFlushed = m_StagingFenced = m_StagedBytes = 0;
+        m_PendingUploads.clear();
     }
 
     void RenderDevice::CreateForwardPlusBuffers(uint32_t width, uint32_t height) {
@@ -493,19 +742,18 @@ namespace Platform {
         // Only recreate if size changed
         if (newTileBufferSize != m_TileBufferSize) {
             if (m_TileLightIndicesBuffer) {
-                SDL_ReleaseGPUBuffer(m_Device, m_TileLightIndicesBuffer);
+                ReleaseBuffer(m_TileLightIndicesBuffer);
             }
             
             SDL_GPUBufferCreateInfo bufferInfo = {};
             bufferInfo.usage = SDL_GPU_BUFFERUSAGE_COMPUTE_STORAGE_WRITE | SDL_GPU_BUFFERUSAGE_GRAPHICS_STORAGE_READ;
             bufferInfo.size = newTileBufferSize;
             
-            m_TileLightIndicesBuffer = SDL_CreateGPUBuffer(m_Device, &bufferInfo);
+            m_TileLightIndicesBuffer = CreateBuffer(&bufferInfo);
             m_TileBufferSize = newTileBufferSize;
             
             if (m_TileLightIndicesBuffer) {
-                std::cout << "Forward+ tile buffer created: " << m_NumTilesX << "x" << m_NumTilesY 
-                          << " tiles (" << newTileBufferSize / 1024 << " KB)" << std::endl;
+                LOG_CORE_INFO("Forward+ tile buffer created: {}x{} tiles ({} KB)", m_NumTilesX, m_NumTilesY, newTileBufferSize / 1024);
             }
         }
         
@@ -516,9 +764,9 @@ namespace Platform {
             // Light data: numLights (4 bytes) + padding (12 bytes) + MAX_POINT_LIGHTS * 32 bytes (2 vec4s per light)
             bufferInfo.size = 16 + MAX_POINT_LIGHTS * 32;
             
-            m_LightBuffer = SDL_CreateGPUBuffer(m_Device, &bufferInfo);
+            m_LightBuffer = CreateBuffer(&bufferInfo);
             if (m_LightBuffer) {
-                std::cout << "Forward+ light buffer created: " << bufferInfo.size / 1024 << " KB" << std::endl;
+                LOG_CORE_INFO("Forward+ light buffer created: {} KB", bufferInfo.size / 1024);
             }
         }
         
@@ -531,7 +779,7 @@ namespace Platform {
             samplerInfo.address_mode_u = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
             samplerInfo.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
             samplerInfo.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
-            m_DepthSampler = SDL_CreateGPUSampler(m_Device, &samplerInfo);
+            m_DepthSampler = CreateSampler(&samplerInfo);
         }
     }
 
@@ -548,45 +796,16 @@ namespace Platform {
         depthStencilInfo.stencil_store_op = SDL_GPU_STOREOP_STORE;
         depthStencilInfo.cycle = true;
         
-        m_RenderPass = SDL_BeginGPURenderPass(m_CommandBuffer, nullptr, 0, &depthStencilInfo);
+        m_RenderPass = BeginRenderPass(m_CommandBuffer, nullptr, 0, &depthStencilInfo);
         return m_RenderPass != nullptr;
     }
 
     void RenderDevice::UpdateLightBuffer(const void* lightData, uint32_t numLights) {
-        if (!m_LightBuffer || !m_CommandBuffer) return;
+        if (!m_LightBuffer) return;
         
         // Calculate data size: header (16 bytes) + lights (32 bytes each)
         uint32_t dataSize = 16 + numLights * 32;
-        
-        // Create transfer buffer
-        SDL_GPUTransferBufferCreateInfo transferInfo = {};
-        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-        transferInfo.size = dataSize;
-        
-        SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_Device, &transferInfo);
-        if (!transferBuffer) return;
-        
-        void* map = SDL_MapGPUTransferBuffer(m_Device, transferBuffer, false);
-        if (map) {
-            memcpy(map, lightData, dataSize);
-            SDL_UnmapGPUTransferBuffer(m_Device, transferBuffer);
-            
-            SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(m_CommandBuffer);
-            
-            SDL_GPUTransferBufferLocation source = {};
-            source.transfer_buffer = transferBuffer;
-            source.offset = 0;
-            
-            SDL_GPUBufferRegion destination = {};
-            destination.buffer = m_LightBuffer;
-            destination.offset = 0;
-            destination.size = dataSize;
-            
-            SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-            SDL_EndGPUCopyPass(copyPass);
-        }
-        
-        SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
+        UploadBuffer(m_LightBuffer, 0, lightData, dataSize);
     }
 
     void RenderDevice::EnsureForwardPlusBuffers() {
@@ -608,7 +827,7 @@ namespace Platform {
         tileBufferBinding.buffer = m_TileLightIndicesBuffer;
         tileBufferBinding.cycle = false;
         
-        SDL_GPUComputePass* computePass = SDL_BeginGPUComputePass(
+        SDL_GPUComputePass* computePass = BeginComputePass(
             m_CommandBuffer,
             nullptr, 0,  // No storage texture bindings
             &tileBufferBinding, 1  // Tile buffer binding
@@ -616,17 +835,17 @@ namespace Platform {
         
         if (!computePass) return;
         
-        SDL_BindGPUComputePipeline(computePass, cullingPipeline);
+        BindComputePipeline(computePass, cullingPipeline);
         
         // Bind depth texture sampler (set 0, binding 0 in compute shader)
         SDL_GPUTextureSamplerBinding depthBinding = {};
         depthBinding.texture = m_DepthTexture;
         depthBinding.sampler = m_DepthSampler;
-        SDL_BindGPUComputeSamplers(computePass, 0, &depthBinding, 1);
+        BindComputeSamplers(computePass, 0, &depthBinding, 1);
         
         // Bind light buffer (read-only storage at set 0, binding 1)
         SDL_GPUBuffer* storageBuffers[] = { m_LightBuffer };
-        SDL_BindGPUComputeStorageBuffers(computePass, 0, storageBuffers, 1);
+        BindComputeStorageBuffers(computePass, 0, storageBuffers, 1);
         
         // Push view data uniform
         struct ViewData {
@@ -646,31 +865,29 @@ namespace Platform {
             1.0f / static_cast<float>(m_RenderHeight)
         );
         
-        SDL_PushGPUComputeUniformData(m_CommandBuffer, 0, &viewData, sizeof(viewData));
+        PushComputeUniformData(m_CommandBuffer, 0, &viewData, sizeof(viewData));
         
         // Debug: Log tile calculation once
         static bool loggedTileCalc = false;
         if (!loggedTileCalc) {
             uint32_t computedNumTilesX = (m_RenderWidth + FORWARD_PLUS_TILE_SIZE - 1) / FORWARD_PLUS_TILE_SIZE;
-            std::cout << "[Forward+] screenSize: " << m_RenderWidth << "x" << m_RenderHeight 
-                      << ", numTilesX: " << m_NumTilesX << " (computed: " << computedNumTilesX << ")"
-                      << ", TILE_SIZE: " << FORWARD_PLUS_TILE_SIZE << std::endl;
+            LOG_CORE_DEBUG("[Forward+] screenSize: {}x{}, numTilesX: {} (computed: {}), TILE_SIZE: {}", m_RenderWidth, m_RenderHeight, m_NumTilesX, computedNumTilesX, FORWARD_PLUS_TILE_SIZE);
             loggedTileCalc = true;
         }
         
         // Dispatch compute shader - one workgroup per tile
-        SDL_DispatchGPUCompute(computePass, m_NumTilesX, m_NumTilesY, 1);
+        DispatchCompute(computePass, m_NumTilesX, m_NumTilesY, 1);
         
-        SDL_EndGPUComputePass(computePass);
+        EndComputePass(computePass);
     }
 
     void RenderDevice::CreateShadowMapTexture(uint32_t size) {
         if (m_ShadowMapTexture) {
-            SDL_ReleaseGPUTexture(m_Device, m_ShadowMapTexture);
+            ReleaseTexture(m_ShadowMapTexture);
             m_ShadowMapTexture = nullptr;
         }
         if (m_ShadowSampler) {
-            SDL_ReleaseGPUSampler(m_Device, m_ShadowSampler);
+            ReleaseSampler(m_ShadowSampler);
             m_ShadowSampler = nullptr;
         }
         
@@ -685,9 +902,9 @@ namespace Platform {
         createInfo.num_levels = 1;
         createInfo.sample_count = SDL_GPU_SAMPLECOUNT_1;
         
-        m_ShadowMapTexture = SDL_CreateGPUTexture(m_Device, &createInfo);
+        m_ShadowMapTexture = CreateTexture(&createInfo);
         if (!m_ShadowMapTexture) {
-            std::cerr << "Failed to create shadow map texture: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("Failed to create shadow map texture: {}", SDL_GetError());
             return;
         }
         
@@ -703,19 +920,19 @@ namespace Platform {
         samplerInfo.compare_op = SDL_GPU_COMPAREOP_LESS_OR_EQUAL;
         samplerInfo.enable_compare = true;
         
-        m_ShadowSampler = SDL_CreateGPUSampler(m_Device, &samplerInfo);
+        m_ShadowSampler = CreateSampler(&samplerInfo);
         if (!m_ShadowSampler) {
-            std::cerr << "Failed to create shadow sampler: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("Failed to create shadow sampler: {}", SDL_GetError());
         }
         
         m_ShadowMapSize = size;
-        std::cout << "Shadow map created: " << size << "x" << size << " (D32F)" << std::endl;
+        LOG_CORE_INFO("Shadow map created: {}x{} (D32F)", size, size);
     }
     
     void RenderDevice::SetShadowMapSize(uint32_t size) {
         if (size != m_ShadowMapSize && size > 0) {
             m_ShadowMapSize = size;
-            if (m_ShadowsEnabled && m_Device) {
+            if (m_ShadowsEnabled && (m_Device || IsNull())) {
                 CreateShadowMapTexture(size);
             }
         }
@@ -744,9 +961,9 @@ namespace Platform {
         depthTarget.stencil_load_op = SDL_GPU_LOADOP_DONT_CARE;
         depthTarget.stencil_store_op = SDL_GPU_STOREOP_DONT_CARE;
         
-        m_RenderPass = SDL_BeginGPURenderPass(m_CommandBuffer, nullptr, 0, &depthTarget);
+        m_RenderPass = BeginRenderPass(m_CommandBuffer, nullptr, 0, &depthTarget);
         if (!m_RenderPass) {
-            std::cerr << "BeginShadowPass: SDL_BeginGPURenderPass failed: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("BeginShadowPass: SDL_BeginGPURenderPass failed: {}", SDL_GetError());
             return false;
         }
         
@@ -755,9 +972,296 @@ namespace Platform {
     
     void RenderDevice::EndShadowPass() {
         if (m_RenderPass) {
-            SDL_EndGPURenderPass(m_RenderPass);
+            EndRenderPass(m_RenderPass);
             m_RenderPass = nullptr;
         }
     }
 
+    // ========== SDL_GPU wrappers ==========
+    // The null backend hands out placeholder handles and skips the SDL call; both backends count
+    // what was issued.
+
+    SDL_GPUTexture* RenderDevice::CreateTexture(const SDL_GPUTextureCreateInfo* info) {
+        if (IsNull()) return CreateNullHandle<SDL_GPUTexture>();
+        return SDL_CreateGPUTexture(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseTexture(SDL_GPUTexture* texture) {
+        if (!texture) return;
+        {
+            // Its queued uploads would otherwise be recorded against a released texture
+            std::lock_guard<std::mutex> lock(m_StagingMutex);
+            std::erase_if(m_PendingUploads, [texture](const PendingUpload& upload) {
+                return upload.kind == PendingUpload::Kind::Texture && upload.region.texture == texture;
+            });
+        }
+        if (IsNull()) return;
+        SDL_ReleaseGPUTexture(m_Device, texture);
+    }
+
+    SDL_GPUBuffer* RenderDevice::CreateBuffer(const SDL_GPUBufferCreateInfo* info) {
+        if (IsNull()) return CreateNullHandle<SDL_GPUBuffer>();
+        return SDL_CreateGPUBuffer(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseBuffer(SDL_GPUBuffer* buffer) {
+        if (!buffer) return;
+        {
+            std::lock_guard<std::mutex> lock(m_StagingMutex);
+            std::erase_if(m_PendingUploads, [buffer](const PendingUpload& upload) {
+                return upload.buffer == buffer || upload.source == buffer;
+            });
+        }
+        if (IsNull()) return;
+        SDL_ReleaseGPUBuffer(m_Device, buffer);
+    }
+
+    SDL_GPUTransferBuffer* RenderDevice::CreateTransferBuffer(const SDL_GPUTransferBufferCreateInfo* info) {
+        if (IsNull()) {
+            SDL_GPUTransferBuffer* transferBuffer = CreateNullHandle<SDL_GPUTransferBuffer>();
+            m_NullTransferMemory[transferBuffer].resize(info->size);
+            return transferBuffer;
+        }
+        return SDL_CreateGPUTransferBuffer(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) {
+        if (!transferBuffer) return;
+        if (IsNull()) {
+            m_NullTransferMemory.erase(transferBuffer);
+            return;
+        }
+        SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
+    }
+
+    void* RenderDevice::MapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer, bool cycle) {
+        if (IsNull()) {
+            auto it = m_NullTransferMemory.find(transferBuffer);
+            return it != m_NullTransferMemory.end() ? it->second.data() : nullptr;
+        }
+        return SDL_MapGPUTransferBuffer(m_Device, transferBuffer, cycle);
+    }
+
+    void RenderDevice::UnmapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer) {
+        if (IsNull()) return;
+        SDL_UnmapGPUTransferBuffer(m_Device, transferBuffer);
+    }
+
+    SDL_GPUSampler* RenderDevice::CreateSampler(const SDL_GPUSamplerCreateInfo* info) {
+        if (IsNull()) return CreateNullHandle<SDL_GPUSampler>();
+        return SDL_CreateGPUSampler(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseSampler(SDL_GPUSampler* sampler) {
+        if (IsNull() || !sampler) return;
+        SDL_ReleaseGPUSampler(m_Device, sampler);
+    }
+
+    SDL_GPUGraphicsPipeline* RenderDevice::CreateGraphicsPipeline(const SDL_GPUGraphicsPipelineCreateInfo* info) {
+        if (IsNull()) return CreateNullHandle<SDL_GPUGraphicsPipeline>();
+        return SDL_CreateGPUGraphicsPipeline(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline) {
+        if (IsNull() || !pipeline) return;
+        SDL_ReleaseGPUGraphicsPipeline(m_Device, pipeline);
+    }
+
+    SDL_GPUComputePipeline* RenderDevice::CreateComputePipeline(const SDL_GPUComputePipelineCreateInfo* info) {
+        if (IsNull()) return CreateNullHandle<SDL_GPUComputePipeline>();
+        return SDL_CreateGPUComputePipeline(m_Device, info);
+    }
+
+    void RenderDevice::ReleaseComputePipeline(SDL_GPUComputePipeline* pipeline) {
+        if (IsNull() || !pipeline) return;
+        SDL_ReleaseGPUComputePipeline(m_Device, pipeline);
+    }
+
+    SDL_GPUCommandBuffer* RenderDevice::AcquireCommandBuffer() {
+        if (IsNull()) return CreateNullHandle<SDL_GPUCommandBuffer>();
+        return SDL_AcquireGPUCommandBuffer(m_Device);
+    }
+
+    void RenderDevice::SubmitCommandBuffer(SDL_GPUCommandBuffer* cmd) {
+        if (IsNull()) return;
+        SDL_SubmitGPUCommandBuffer(cmd);
+    }
+
+    SDL_GPURenderPass* RenderDevice::BeginRenderPass(SDL_GPUCommandBuffer* cmd, const SDL_GPUColorTargetInfo* colorTargets,
+                                                     uint32_t numColorTargets, const SDL_GPUDepthStencilTargetInfo* depthStencilTarget) {
+        m_FrameStats.renderPasses++;
+        Record(GPUCommandType::BeginRenderPass, numColorTargets, depthStencilTarget ? 1 : 0);
+        if (IsNull()) return CreateNullHandle<SDL_GPURenderPass>();
+        return SDL_BeginGPURenderPass(cmd, colorTargets, numColorTargets, depthStencilTarget);
+    }
+
+    void RenderDevice::EndRenderPass(SDL_GPURenderPass* pass) {
+        Record(GPUCommandType::EndRenderPass);
+        if (IsNull()) return;
+        SDL_EndGPURenderPass(pass);
+    }
+
+    SDL_GPUCopyPass* RenderDevice::BeginCopyPass(SDL_GPUCommandBuffer* cmd) {
+        m_FrameStats.copyPasses++;
+        Record(GPUCommandType::BeginCopyPass);
+        if (IsNull()) return CreateNullHandle<SDL_GPUCopyPass>();
+        return SDL_BeginGPUCopyPass(cmd);
+    }
+
+    void RenderDevice::EndCopyPass(SDL_GPUCopyPass* copyPass) {
+        Record(GPUCommandType::EndCopyPass);
+        if (IsNull()) return;
+        SDL_EndGPUCopyPass(copyPass);
+    }
+
+    void RenderDevice::UploadToBuffer(SDL_GPUCopyPass* copyPass, const SDL_GPUTransferBufferLocation* source,
+                                      const SDL_GPUBufferRegion* destination, bool cycle) {
+        m_FrameStats.uploadBytes += destination->size;
+        Record(GPUCommandType::UploadBuffer, destination->size);
+        if (IsNull()) return;
+        SDL_UploadToGPUBuffer(copyPass, source, destination, cycle);
+    }
+
+    void RenderDevice::UploadToTexture(SDL_GPUCopyPass* copyPass, const SDL_GPUTextureTransferInfo* source,
+                                       const SDL_GPUTextureRegion* destination, bool cycle) {
+        m_FrameStats.textureUploads++;
+        Record(GPUCommandType::UploadTexture, destination->w * destination->h, destination->d);
+        if (IsNull()) return;
+        SDL_UploadToGPUTexture(copyPass, source, destination, cycle);
+    }
+
+    void RenderDevice::CopyBufferToBuffer(SDL_GPUCopyPass* copyPass, const SDL_GPUBufferLocation* source,
+                                          const SDL_GPUBufferLocation* destination, uint32_t size, bool cycle) {
+        m_FrameStats.copyBytes += size;
+        Record(GPUCommandType::CopyBuffer, size);
+        if (IsNull()) return;
+        SDL_CopyGPUBufferToBuffer(copyPass, source, destination, size, cycle);
+    }
+
+    SDL_GPUComputePass* RenderDevice::BeginComputePass(SDL_GPUCommandBuffer* cmd,
+                                                       const SDL_GPUStorageTextureReadWriteBinding* textureBindings, uint32_t numTextureBindings,
+                                                       const SDL_GPUStorageBufferReadWriteBinding* bufferBindings, uint32_t numBufferBindings) {
+        Record(GPUCommandType::BeginComputePass, numTextureBindings, numBufferBindings);
+        if (IsNull()) return CreateNullHandle<SDL_GPUComputePass>();
+        return SDL_BeginGPUComputePass(cmd, textureBindings, numTextureBindings, bufferBindings, numBufferBindings);
+    }
+
+    void RenderDevice::EndComputePass(SDL_GPUComputePass* computePass) {
+        Record(GPUCommandType::EndComputePass);
+        if (IsNull()) return;
+        SDL_EndGPUComputePass(computePass);
+    }
+
+    void RenderDevice::BindComputePipeline(SDL_GPUComputePass* computePass, SDL_GPUComputePipeline* pipeline) {
+        m_FrameStats.pipelineBinds++;
+        Record(GPUCommandType::BindPipeline);
+        if (IsNull()) return;
+        SDL_BindGPUComputePipeline(computePass, pipeline);
+    }
+
+    void RenderDevice::BindComputeSamplers(SDL_GPUComputePass* computePass, uint32_t firstSlot,
+                                           const SDL_GPUTextureSamplerBinding* bindings, uint32_t numBindings) {
+        Record(GPUCommandType::BindSamplers, numBindings);
+        if (IsNull()) return;
+        SDL_BindGPUComputeSamplers(computePass, firstSlot, bindings, numBindings);
+    }
+
+    void RenderDevice::BindComputeStorageBuffers(SDL_GPUComputePass* computePass, uint32_t firstSlot,
+                                                 SDL_GPUBuffer* const* buffers, uint32_t numBuffers) {
+        Record(GPUCommandType::BindStorageBuffers, numBuffers);
+        if (IsNull()) return;
+        SDL_BindGPUComputeStorageBuffers(computePass, firstSlot, buffers, numBuffers);
+    }
+
+    void RenderDevice::DispatchCompute(SDL_GPUComputePass* computePass, uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ) {
+        m_FrameStats.computeDispatches++;
+        Record(GPUCommandType::Dispatch, groupsX * groupsY * groupsZ);
+        if (IsNull()) return;
+        SDL_DispatchGPUCompute(computePass, groupsX, groupsY, groupsZ);
+    }
+
+    void RenderDevice::BindGraphicsPipeline(SDL_GPURenderPass* pass, SDL_GPUGraphicsPipeline* pipeline) {
+        m_FrameStats.pipelineBinds++;
+        Record(GPUCommandType::BindPipeline);
+        if (IsNull()) return;
+        SDL_BindGPUGraphicsPipeline(pass, pipeline);
+    }
+
+    void RenderDevice::SetViewport(SDL_GPURenderPass* pass, const SDL_GPUViewport* viewport) {
+        Record(GPUCommandType::SetViewport);
+        if (IsNull()) return;
+        SDL_SetGPUViewport(pass, viewport);
+    }
+
+    void RenderDevice::BindVertexBuffers(SDL_GPURenderPass* pass, uint32_t firstSlot, const SDL_GPUBufferBinding* bindings, uint32_t numBindings) {
+        Record(GPUCommandType::BindVertexBuffers, numBindings);
+        if (IsNull()) return;
+        SDL_BindGPUVertexBuffers(pass, firstSlot, bindings, numBindings);
+    }
+
+    void RenderDevice::BindIndexBuffer(SDL_GPURenderPass* pass, const SDL_GPUBufferBinding* binding, SDL_GPUIndexElementSize indexElementSize) {
+        Record(GPUCommandType::BindIndexBuffer);
+        if (IsNull()) return;
+        SDL_BindGPUIndexBuffer(pass, binding, indexElementSize);
+    }
+
+    void RenderDevice::BindFragmentSamplers(SDL_GPURenderPass* pass, uint32_t firstSlot,
+                                            const SDL_GPUTextureSamplerBinding* bindings, uint32_t numBindings) {
+        Record(GPUCommandType::BindSamplers, numBindings);
+        if (IsNull()) return;
+        SDL_BindGPUFragmentSamplers(pass, firstSlot, bindings, numBindings);
+    }
+
+    void RenderDevice::BindFragmentStorageBuffers(SDL_GPURenderPass* pass, uint32_t firstSlot,
+                                                  SDL_GPUBuffer* const* buffers, uint32_t numBuffers) {
+        Record(GPUCommandType::BindStorageBuffers, numBuffers);
+        if (IsNull()) return;
+        SDL_BindGPUFragmentStorageBuffers(pass, firstSlot, buffers, numBuffers);
+    }
+
+    void RenderDevice::PushVertexUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length) {
+        m_FrameStats.uniformBytes += length;
+        Record(GPUCommandType::PushUniforms, length, slot);
+        if (IsNull()) return;
+        SDL_PushGPUVertexUniformData(cmd, slot, data, length);
+    }
+
+    void RenderDevice::PushFragmentUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length) {
+        m_FrameStats.uniformBytes += length;
+        Record(GPUCommandType::PushUniforms, length, slot);
+        if (IsNull()) return;
+        SDL_PushGPUFragmentUniformData(cmd, slot, data, length);
+    }
+
+    void RenderDevice::PushComputeUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length) {
+        m_FrameStats.uniformBytes += length;
+        Record(GPUCommandType::PushUniforms, length, slot);
+        if (IsNull()) return;
+        SDL_PushGPUComputeUniformData(cmd, slot, data, length);
+    }
+
+    void RenderDevice::DrawPrimitives(SDL_GPURenderPass* pass, uint32_t numVertices, uint32_t numInstances,
+                                      uint32_t firstVertex, uint32_t firstInstance) {
+        m_FrameStats.drawCalls++;
+        m_FrameStats.instances += numInstances;
+        Record(GPUCommandType::Draw, numVertices, numInstances);
+        if (IsNull()) return;
+        SDL_DrawGPUPrimitives(pass, numVertices, numInstances, firstVertex, firstInstance);
+    }
+
+    void RenderDevice::DrawIndexedPrimitives(SDL_GPURenderPass* pass, uint32_t numIndices, uint32_t numInstances,
+                                             uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance) {
+        m_FrameStats.drawCalls++;
+        m_FrameStats.instances += numInstances;
+        Record(GPUCommandType::DrawIndexed, numIndices, numInstances);
+        if (IsNull()) return;
+        SDL_DrawGPUIndexedPrimitives(pass, numIndices, numInstances, firstIndex, vertexOffset, firstInstance);
+    }
+
+    void RenderDevice::BlitTexture(SDL_GPUCommandBuffer* cmd, const SDL_GPUBlitInfo* info) {
+        Record(GPUCommandType::Blit, info->destination.w, info->destination.h);
+        if (IsNull()) return;
+        SDL_BlitGPUTexture(cmd, info);
+    }
+
 }
@@ -2,6 +2,10 @@
 
 #include <SDL3/SDL.h>
 #include <glm/glm.hpp>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
 
 namespace Platform {
 
@@ -19,21 +23,149 @@ namespace Platform {
     constexpr uint32_t MAX_LIGHTS_PER_TILE = 256;
     constexpr uint32_t MAX_POINT_LIGHTS = 1024;
 
+    enum class RenderBackend {
+        SDL = 0,  // SDL3 GPU device bound to a window
+        Null = 1  // No GPU: commands are counted (and optionally recorded) but never executed
+    };
+
+    // Commands issued through the RenderDevice during one frame
+    struct GPUFrameStats {
+        uint32_t drawCalls = 0;
+        uint32_t instances = 0;
+        uint32_t pipelineBinds = 0;
+        uint32_t renderPasses = 0;
+        uint32_t copyPasses = 0;
+        uint32_t computeDispatches = 0;
+        uint32_t textureUploads = 0;
+        uint64_t uploadBytes = 0;   // Buffer uploads
+        uint64_t stagingBytes = 0;  // Written into the staging ring, buffers and textures
+        uint64_t copyBytes = 0;     // Buffer-to-buffer copies on the GPU
+        uint64_t uniformBytes = 0;  // Pushed uniform data
+    };
+
+    enum class GPUCommandType : uint8_t {
+        BeginRenderPass, EndRenderPass,
+        BeginCopyPass, EndCopyPass,
+        BeginComputePass, EndComputePass,
+        UploadBuffer, UploadTexture, CopyBuffer,
+        BindPipeline, SetViewport,
+        BindVertexBuffers, BindIndexBuffer, BindSamplers, BindStorageBuffers,
+        PushUniforms,
+        Draw, DrawIndexed, Dispatch, Blit
+    };
+
+    // One recorded command. a/b carry the interesting sizes: byte counts for uploads and uniforms,
+    // vertex/index and instance counts for draws, binding counts for binds.
+    struct GPUCommand {
+        GPUCommandType type;
+        uint32_t a = 0;
+        uint32_t b = 0;
+    };
+
     class RenderDevice {
     public:
         RenderDevice();
         ~RenderDevice();
 
         bool Init(Window* window);
+        // GPU-less backend with a fixed size "swapchain". Everything RenderSystem does on the CPU
+        // still runs; GPU objects are placeholder handles that are never handed to SDL.
+        bool InitNull(uint32_t width = 1280, uint32_t height = 720);
         void Shutdown();
 
-        SDL_GPUDevice* GetDevice() const { return m_Device; }
+        RenderBackend GetBackend() const { return m_Backend; }
+        bool IsNull() const { return m_Backend == RenderBackend::Null; }
+
+        SDL_GPUDevice* GetDevice() const { return m_Device; } // nullptr on the null backend
         Window* GetWindow() const { return m_Window; }
         SDL_GPUCommandBuffer* GetCommandBuffer() const { return m_CommandBuffer; }
         SDL_GPURenderPass* GetRenderPass() const { return m_RenderPass; }
         SDL_GPUTextureFormat GetSwapchainTextureFormat() const;
+        const char* GetDriverName() const;
+        float GetAspectRatio() const;
+
+        // Swapchain present mode. Without vsync, mailbox is preferred over immediate (no tearing).
+        // Returns false and keeps the current mode if the window supports neither.
+        bool SetVSync(bool enabled);
 
+        // RGBA8 texture. The pixels are staged and reach the GPU with the next FlushUploads().
         SDL_GPUTexture* CreateTexture(uint32_t width, uint32_t height, const void* data);
+
+        // Staged uploads. The data is copied into a ring of transfer memory right away and the copy is
+        // queued; FlushUploads() records everything queued in one copy pass on the frame's command buffer.
+        // Ring space is reused once the frame that uploaded from it has finished on the GPU. Thread-safe,
+        // so resources can be created from any thread: they are uploaded with the next frame.
+        // Returns false if the ring could not make room.
+        bool UploadBuffer(SDL_GPUBuffer* buffer, uint32_t offset, const void* data, uint32_t size, bool cycle = false);
+        bool UploadTexture(const SDL_GPUTextureRegion& region, const void* data, uint32_t size);  // Tightly packed rows
+        // GPU-side copy, kept in order with the staged uploads
+        void QueueBufferCopy(SDL_GPUBuffer* source, uint32_t sourceOffset, SDL_GPUBuffer* destination,
+                             uint32_t destinationOffset, uint32_t size);
+        void FlushUploads();
+        uint32_t GetStagingCapacity() const;
+
+        // Command statistics. The current frame accumulates until EndFrame(), which publishes it.
+        const GPUFrameStats& GetFrameStats() const { return m_LastFrameStats; }
+        void SetCommandRecording(bool enabled) { m_RecordCommands = enabled; }
+        bool IsCommandRecording() const { return m_RecordCommands; }
+        const std::vector<GPUCommand>& GetRecordedCommands() const { return m_LastFrameCommands; }
+
+        // GPU object creation. Mirrors the SDL_GPU API minus the device argument.
+        SDL_GPUTexture* CreateTexture(const SDL_GPUTextureCreateInfo* info);
+        void ReleaseTexture(SDL_GPUTexture* texture);
+        SDL_GPUBuffer* CreateBuffer(const SDL_GPUBufferCreateInfo* info);
+        void ReleaseBuffer(SDL_GPUBuffer* buffer);
+        SDL_GPUTransferBuffer* CreateTransferBuffer(const SDL_GPUTransferBufferCreateInfo* info);
+        void ReleaseTransferBuffer(SDL_GPUTransferBuffer* transferBuffer);
+        void* MapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer, bool cycle);
+        void UnmapTransferBuffer(SDL_GPUTransferBuffer* transferBuffer);
+        SDL_GPUSampler* CreateSampler(const SDL_GPUSamplerCreateInfo* info);
+        void ReleaseSampler(SDL_GPUSampler* sampler);
+        SDL_GPUGraphicsPipeline* CreateGraphicsPipeline(const SDL_GPUGraphicsPipelineCreateInfo* info);
+        void ReleaseGraphicsPipeline(SDL_GPUGraphicsPipeline* pipeline);
+        SDL_GPUComputePipeline* CreateComputePipeline(const SDL_GPUComputePipelineCreateInfo* info);
+        void ReleaseComputePipeline(SDL_GPUComputePipeline* pipeline);
+
+        // Command encoding. Every GPU command goes through here so it can be counted.
+        SDL_GPUCommandBuffer* AcquireCommandBuffer();
+        void SubmitCommandBuffer(SDL_GPUCommandBuffer* cmd);
+        SDL_GPURenderPass* BeginRenderPass(SDL_GPUCommandBuffer* cmd, const SDL_GPUColorTargetInfo* colorTargets,
+                                           uint32_t numColorTargets, const SDL_GPUDepthStencilTargetInfo* depthStencilTarget);
+        void EndRenderPass(SDL_GPURenderPass* pass);
+        SDL_GPUCopyPass* BeginCopyPass(SDL_GPUCommandBuffer* cmd);
+        void EndCopyPass(SDL_GPUCopyPass* copyPass);
+        void UploadToBuffer(SDL_GPUCopyPass* copyPass, const SDL_GPUTransferBufferLocation* source,
+                            const SDL_GPUBufferRegion* destination, bool cycle);
+        void UploadToTexture(SDL_GPUCopyPass* copyPass, const SDL_GPUTextureTransferInfo* source,
+                             const SDL_GPUTextureRegion* destination, bool cycle);
+        void CopyBufferToBuffer(SDL_GPUCopyPass* copyPass, const SDL_GPUBufferLocation* source,
+                                const SDL_GPUBufferLocation* destination, uint32_t size, bool cycle);
+        SDL_GPUComputePass* BeginComputePass(SDL_GPUCommandBuffer* cmd,
+                                             const SDL_GPUStorageTextureReadWriteBinding* textureBindings, uint32_t numTextureBindings,
+                                             const SDL_GPUStorageBufferReadWriteBinding* bufferBindings, uint32_t numBufferBindings);
+        void EndComputePass(SDL_GPUComputePass* computePass);
+        void BindComputePipeline(SDL_GPUComputePass* computePass, SDL_GPUComputePipeline* pipeline);
+        void BindComputeSamplers(SDL_GPUComputePass* computePass, uint32_t firstSlot,
+                                 const SDL_GPUTextureSamplerBinding* bindings, uint32_t numBindings);
+        void BindComputeStorageBuffers(SDL_GPUComputePass* computePass, uint32_t firstSlot,
+                                       SDL_GPUBuffer* const* buffers, uint32_t numBuffers);
+        void DispatchCompute(SDL_GPUComputePass* computePass, uint32_t groupsX, uint32_t groupsY, uint32_t groupsZ);
+        void BindGraphicsPipeline(SDL_GPURenderPass* pass, SDL_GPUGraphicsPipeline* pipeline);
+        void SetViewport(SDL_GPURenderPass* pass, const SDL_GPUViewport* viewport);
+        void BindVertexBuffers(SDL_GPURenderPass* pass, uint32_t firstSlot, const SDL_GPUBufferBinding* bindings, uint32_t numBindings);
+        void BindIndexBuffer(SDL_GPURenderPass* pass, const SDL_GPUBufferBinding* binding, SDL_GPUIndexElementSize indexElementSize);
+        void BindFragmentSamplers(SDL_GPURenderPass* pass, uint32_t firstSlot,
+                                  const SDL_GPUTextureSamplerBinding* bindings, uint32_t numBindings);
+        void BindFragmentStorageBuffers(SDL_GPURenderPass* pass, uint32_t firstSlot,
+                                        SDL_GPUBuffer* const* buffers, uint32_t numBuffers);
+        void PushVertexUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length);
+        void PushFragmentUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length);
+        void PushComputeUniformData(SDL_GPUCommandBuffer* cmd, uint32_t slot, const void* data, uint32_t length);
+        void DrawPrimitives(SDL_GPURenderPass* pass, uint32_t numVertices, uint32_t numInstances,
+                            uint32_t firstVertex, uint32_t firstInstance);
+        void DrawIndexedPrimitives(SDL_GPURenderPass* pass, uint32_t numIndices, uint32_t numInstances,
+                                   uint32_t firstIndex, int32_t vertexOffset, uint32_t firstInstance);
+        void BlitTexture(SDL_GPUCommandBuffer* cmd, const SDL_GPUBlitInfo* info);
         
         // HDR Pipeline
         bool IsHDREnabled() const { return m_HDREnabled; }
@@ -137,6 +269,23 @@ namespace Platform {
         void CreateSSGITextures(uint32_t width, uint32_t height);
         void CreateNoiseTexture();
 
+        // Staging ring, all under m_StagingMutex
+        uint8_t* AllocateStaging(uint32_t size, uint32_t alignment, SDL_GPUTransferBuffer*& transferBuffer, uint32_t& offset);
+        bool GrowStaging(uint32_t size);
+        void RetireStaging(bool wait);
+        void ReleaseStaging();
+
+        // Null backend handles are unique, non-null and never dereferenced
+        template<typename T>
+        T* CreateNullHandle() { return reinterpret_cast<T*>(static_cast<uintptr_t>(++m_NullHandleCounter)); }
+
+        void Record(GPUCommandType type, uint32_t a = 0, uint32_t b = 0) {
+            if (m_RecordCommands) {
+                m_Commands.push_back({ type, a, b });
+            }
+        }
+
+        RenderBackend m_Backend = RenderBackend::SDL;
         SDL_GPUDevice* m_Device = nullptr;
         Window* m_Window = nullptr;
         SDL_GPUCommandBuffer* m_CommandBuffer = nullptr;
@@ -204,6 +353,57 @@ namespace Platform {
         
         // Frame validity
         bool m_FrameValid = false;
+
+        // Command statistics / recording
+        GPUFrameStats m_FrameStats;
+        GPUFrameStats m_LastFrameStats;
+        bool m_RecordCommands = false;
+        std::vector<GPUCommand> m_Commands;
+        std::vector<GPUCommand> m_LastFrameCommands;
+
+        // Staging ring. Positions only ever grow; a position's byte is at (position - m_StagingBase) % capacity.
+        // Everything below m_StagingTail has been consumed by the GPU.
+        struct PendingUpload {
+            enum class Kind : uint8_t { Buffer, Texture, Copy };
+            Kind kind = Kind::Buffer;
+            bool cycle = false;
+            SDL_GPUTransferBuffer* transferBuffer = nullptr;
+            uint32_t transferOffset = 0;
+            SDL_GPUBuffer* source = nullptr;       // Copy
+            uint32_t sourceOffset = 0;
+            SDL_GPUBuffer* buffer = nullptr;       // Buffer, Copy
+            uint32_t offset = 0;
+            uint32_t size = 0;
+            SDL_GPUTextureRegion region = {};      // Texture
+        };
+        struct StagingFence {
+            SDL_GPUFence* fence = nullptr;
+            uint64_t end = 0;  // Head at the flush this frame submitted
+        };
+        struct RetiredStaging {
+            SDL_GPUTransferBuffer* transferBuffer = nullptr;
+            uint64_t end = 0;  // Released once the tail passes it
+        };
+        mutable std::mutex m_StagingMutex;
+        SDL_GPUTransferBuffer* m_StagingBuffer = nullptr;
+        uint8_t* m_StagingMap = nullptr;  // Mapped from the first write after a flush until the next flush
+        uint32_t m_StagingCapacity = 0;
+        uint64_t m_StagingBase = 0;
+        uint64_t m_StagingHead = 0;
+        uint64_t m_StagingTail = 0;
+        uint64_t m_StagingFlushed = 0;    // Head when the last copy pass was recorded
+        uint64_t m_StagingFenced = 0;     // Flushed bytes already covered by a fence
+        uint64_t m_StagedBytes = 0;       // Since the last EndFrame
+        std::vector<PendingUpload> m_PendingUploads;
+        std::deque<StagingFence> m_StagingFences;
+        std::vector<RetiredStaging> m_RetiredStaging;
+
+        // Null backend
+        uint32_t m_NullWidth = 0;
+        uint32_t m_NullHeight = 0;
+        uintptr_t m_NullHandleCounter = 0;
+        SDL_GPUTexture* m_NullSwapchainTexture = nullptr;
+        std::unordered_map<SDL_GPUTransferBuffer*, std::vector<uint8_t>> m_NullTransferMemory; // Real memory so CPU copies stay measurable
     };
 
 }
@@ -1,5 +1,5 @@
 #include "Window.h"
-#include <iostream>
+#include "../Core/Log.h"
 
 namespace Platform {
 
@@ -11,13 +11,13 @@ namespace Platform {
 
     bool Window::Init() {
         if (!SDL_Init(SDL_INIT_VIDEO | SDL_INIT_EVENTS)) {
-            std::cerr << "SDL_Init Error: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("SDL_Init Error: {}", SDL_GetError());
             return false;
         }
 
         m_Window = SDL_CreateWindow(m_Data.Title.c_str(), m_Data.Width, m_Data.Height, SDL_WINDOW_RESIZABLE);
         if (!m_Window) {
-            std::cerr << "SDL_CreateWindow Error: " << SDL_GetError() << std::endl;
+            LOG_CORE_ERROR("SDL_CreateWindow Error: {}", SDL_GetError());
             return false;
         }
 
@@ -1,22 +1,52 @@
 #include "Mesh.h"
 #include "../Platform/RenderDevice.h"
+#include "../Core/Log.h"
+#include <algorithm>
+#include <cmath>
 #include <set>
 
 namespace Resources {
 
-    Mesh::Mesh(SDL_GPUDevice* device, SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount)
-        : m_Device(device), m_VertexBuffer(vertexBuffer), m_IndexBuffer(indexBuffer), m_VertexCount(vertexCount), m_IndexCount(indexCount)
+    static_assert(sizeof(MeshBounds) == 10 * sizeof(float), "MeshBounds is read straight from .oakmesh");
+    static_assert(sizeof(Submesh) == 2 * sizeof(uint32_t) + sizeof(MeshBounds), "Submesh is read straight from .oakmesh");
+
+    namespace {
+        constexpr uint32_t OakMeshVersion = 2;
+    }
+
+    MeshBounds MeshBounds::FromVertices(const Vertex* vertices, size_t count) {
+        MeshBounds bounds;
+        if (count == 0) return bounds;
+
+        bounds.min = bounds.max = vertices[0].position;
+        for (size_t i = 1; i < count; ++i) {
+            bounds.min = glm::min(bounds.min, vertices[i].position);
+            bounds.max = glm::max(bounds.max, vertices[i].position);
+        }
+        bounds.center = (bounds.min + bounds.max) * 0.5f;
+
+        float radiusSq = 0.0f;
+        for (size_t i = 0; i < count; ++i) {
+            glm::vec3 d = vertices[i].position - bounds.center;
+            radiusSq = std::max(radiusSq, glm::dot(d, d));
+        }
+        bounds.radius = std::sqrt(radiusSq);
+        return bounds;
+    }
+
+    Mesh::Mesh(Platform::RenderDevice* renderDevice, SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount)
+        : m_RenderDevice(renderDevice), m_VertexBuffer(vertexBuffer), m_IndexBuffer(indexBuffer), m_VertexCount(vertexCount), m_IndexCount(indexCount)
     {
     }
 
     Mesh::~Mesh() {
-        if (m_VertexBuffer) SDL_ReleaseGPUBuffer(m_Device, m_VertexBuffer);
-        if (m_IndexBuffer) SDL_ReleaseGPUBuffer(m_Device, m_IndexBuffer);
+        if (m_VertexBuffer) m_RenderDevice->ReleaseBuffer(m_VertexBuffer);
+        if (m_IndexBuffer) m_RenderDevice->ReleaseBuffer(m_IndexBuffer);
     }
 
     void Mesh::UpdateMesh(SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount) {
-        if (m_VertexBuffer) SDL_ReleaseGPUBuffer(m_Device, m_VertexBuffer);
-        if (m_IndexBuffer) SDL_ReleaseGPUBuffer(m_Device, m_IndexBuffer);
+        if (m_VertexBuffer) m_RenderDevice->ReleaseBuffer(m_VertexBuffer);
+        if (m_IndexBuffer) m_RenderDevice->ReleaseBuffer(m_IndexBuffer);
 
         m_VertexBuffer = vertexBuffer;
         m_IndexBuffer = indexBuffer;
@@ -28,29 +58,42 @@ namespace Resources {
         std::vector<char> data = ResourceManager::ReadFile(m_Path);
         if (data.empty()) return false;
 
-        // New header with jointRemapCount
+        // Header | Vertices | Indices | IBMs | joint_remaps | Submeshes
         struct OakMeshHeader {
             char signature[4];
+            uint32_t version;
             uint32_t vertexCount;
             uint32_t indexCount;
             uint32_t boneCount;       // COMPACT bone count
             uint32_t jointRemapCount; // Same as boneCount (for joint_remaps)
+            uint32_t submeshCount;
+            MeshBounds bounds;
         };
 
         if (data.size() < sizeof(OakMeshHeader)) return false;
 
         OakMeshHeader* header = reinterpret_cast<OakMeshHeader*>(data.data());
         if (strncmp(header->signature, "OAKM", 4) != 0) return false;
+        if (header->version != OakMeshVersion) {
+            LOG_CORE_ERROR("[Mesh] {} is .oakmesh version {}, expected {}. Recook it.", m_Path, header->version, OakMeshVersion);
+            return false;
+        }
 
         uint32_t vertexDataSize = header->vertexCount * sizeof(Vertex);
         uint32_t indexDataSize = header->indexCount * sizeof(uint32_t);
         uint32_t ibmDataSize = header->boneCount * sizeof(glm::mat4);
         uint32_t remapDataSize = header->jointRemapCount * sizeof(uint16_t);
+        uint32_t submeshDataSize = header->submeshCount * sizeof(Submesh);
+        if (data.size() < sizeof(OakMeshHeader) + vertexDataSize + indexDataSize + ibmDataSize + remapDataSize + submeshDataSize) {
+            LOG_CORE_ERROR("[Mesh] {} is truncated", m_Path);
+            return false;
+        }
         
         const char* vertexData = data.data() + sizeof(OakMeshHeader);
         const char* indexData = vertexData + vertexDataSize;
         const char* ibmData = indexData + indexDataSize;
         const char* remapData = ibmData + ibmDataSize;
+        const char* submeshData = remapData + remapDataSize;
 
         // Read COMPACT IBMs
         m_InverseBindMatrices.clear();
@@ -66,65 +109,39 @@ namespace Resources {
             memcpy(m_JointRemaps.data(), remapData, remapDataSize);
         }
 
+        std::vector<Submesh> submeshes(header->submeshCount);
+        if (submeshDataSize > 0) {
+            memcpy(submeshes.data(), submeshData, submeshDataSize);
+        }
+        SetBounds(header->bounds, std::move(submeshes));
+
+        // Headless: no device to upload to
+        if (!m_RenderDevice) {
+            UpdateMesh(nullptr, nullptr, header->vertexCount, header->indexCount);
+            return true;
+        }
+
         // Create GPU Buffers
         SDL_GPUBufferCreateInfo vertexBufferInfo = {};
         vertexBufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
         vertexBufferInfo.size = vertexDataSize;
-        SDL_GPUBuffer* newVertexBuffer = SDL_CreateGPUBuffer(m_Device, &vertexBufferInfo);
+        SDL_GPUBuffer* newVertexBuffer = m_RenderDevice->CreateBuffer(&vertexBufferInfo);
 
         SDL_GPUBufferCreateInfo indexBufferInfo = {};
         indexBufferInfo.usage = SDL_GPU_BUFFERUSAGE_INDEX;
         indexBufferInfo.size = indexDataSize;
-        SDL_GPUBuffer* newIndexBuffer = SDL_CreateGPUBuffer(m_Device, &indexBufferInfo);
-
-        if (newVertexBuffer && newIndexBuffer) {
-            // Upload
-            uint32_t totalSize = vertexDataSize + indexDataSize;
-            SDL_GPUTransferBufferCreateInfo transferInfo = {};
-            transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferInfo.size = totalSize;
-
-            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_Device, &transferInfo);
-            if (transferBuffer) {
-                void* map = SDL_MapGPUTransferBuffer(m_Device, transferBuffer, false);
-                if (map) {
-                    SDL_memcpy(map, vertexData, vertexDataSize);
-                    SDL_memcpy(static_cast<char*>(map) + vertexDataSize, indexData, indexDataSize);
-                    SDL_UnmapGPUTransferBuffer(m_Device, transferBuffer);
-
-                    SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(m_Device);
-                    SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
-
-                    SDL_GPUTransferBufferLocation source = {};
-                    source.transfer_buffer = transferBuffer;
-                    source.offset = 0;
-
-                    SDL_GPUBufferRegion destination = {};
-                    destination.buffer = newVertexBuffer;
-                    destination.size = vertexDataSize;
-                    destination.offset = 0;
-
-                    SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-
-                    source.offset = vertexDataSize;
-                    destination.buffer = newIndexBuffer;
-                    destination.size = indexDataSize;
-
-                    SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-
-                    SDL_EndGPUCopyPass(copyPass);
-                    SDL_SubmitGPUCommandBuffer(cmd);
-                    SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
-
-                    UpdateMesh(newVertexBuffer, newIndexBuffer, header->vertexCount, header->indexCount);
-                    return true;
-                }
-                SDL_ReleaseGPUTransferBuffer(m_Device, transferBuffer);
-            }
+        SDL_GPUBuffer* newIndexBuffer = m_RenderDevice->CreateBuffer(&indexBufferInfo);
+
+        // Staged; the data reaches the GPU with the next frame's uploads, before anything draws it
+        if (newVertexBuffer && newIndexBuffer &&
+            m_RenderDevice->UploadBuffer(newVertexBuffer, 0, vertexData, vertexDataSize) &&
+            m_RenderDevice->UploadBuffer(newIndexBuffer, 0, indexData, indexDataSize)) {
+            UpdateMesh(newVertexBuffer, newIndexBuffer, header->vertexCount, header->indexCount);
+            return true;
         }
 
-        if (newVertexBuffer) SDL_ReleaseGPUBuffer(m_Device, newVertexBuffer);
-        if (newIndexBuffer) SDL_ReleaseGPUBuffer(m_Device, newIndexBuffer);
+        if (newVertexBuffer) m_RenderDevice->ReleaseBuffer(newVertexBuffer);
+        if (newIndexBuffer) m_RenderDevice->ReleaseBuffer(newIndexBuffer);
 
         return false; 
     }
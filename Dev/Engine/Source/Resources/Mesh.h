@@ -3,6 +3,7 @@
 #include <SDL3/SDL.h>
 #include <glm/glm.hpp>
 #include <vector>
+#include <cstddef>
 #include <cstdint>
 
 namespace Resources {
@@ -15,9 +16,30 @@ namespace Resources {
         glm::vec4 joints;  // COMPACT joint indices (0 to usedJointCount-1)
     };
 
+    // Local-space bounds: a box, and a sphere around the box's center. Same layout as in .oakmesh.
+    struct MeshBounds {
+        glm::vec3 min = glm::vec3(0.0f);
+        glm::vec3 max = glm::vec3(0.0f);
+        glm::vec3 center = glm::vec3(0.0f);
+        float radius = 0.0f;
+
+        // Meshes built without bounds; culling always keeps them
+        bool IsEmpty() const { return radius <= 0.0f; }
+
+        static MeshBounds FromVertices(const Vertex* vertices, size_t count);
+    };
+
+    // One source mesh: a range of the index buffer with its own bounds
+    struct Submesh {
+        uint32_t indexOffset = 0;
+        uint32_t indexCount = 0;
+        MeshBounds bounds;
+    };
+
     class Mesh : public Resource {
     public:
-        Mesh(SDL_GPUDevice* device, SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount);
+        // renderDevice is null when headless; the mesh then only keeps its counts
+        Mesh(Platform::RenderDevice* renderDevice, SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount);
         ~Mesh();
 
         SDL_GPUBuffer* GetVertexBuffer() const { return m_VertexBuffer; }
@@ -33,18 +55,36 @@ namespace Resources {
         
         uint32_t GetUsedJointCount() const { return static_cast<uint32_t>(m_JointRemaps.size()); }
 
+        // For meshes built in code; loaded meshes read both from the file
+        void SetSkinning(std::vector<glm::mat4> inverseBindMatrices, std::vector<uint16_t> jointRemaps) {
+            m_InverseBindMatrices = std::move(inverseBindMatrices);
+            m_JointRemaps = std::move(jointRemaps);
+        }
+
+        // Skinned meshes are bounded over their animation range, not just the bind pose
+        const MeshBounds& GetBounds() const { return m_Bounds; }
+        const std::vector<Submesh>& GetSubmeshes() const { return m_Submeshes; }
+
+        // For meshes built in code; loaded meshes read both from the file
+        void SetBounds(const MeshBounds& bounds, std::vector<Submesh> submeshes) {
+            m_Bounds = bounds;
+            m_Submeshes = std::move(submeshes);
+        }
+
         void UpdateMesh(SDL_GPUBuffer* vertexBuffer, SDL_GPUBuffer* indexBuffer, uint32_t vertexCount, uint32_t indexCount);
 
         virtual bool Reload() override;
 
     private:
-        SDL_GPUDevice* m_Device;
+        Platform::RenderDevice* m_RenderDevice;
         SDL_GPUBuffer* m_VertexBuffer;
         SDL_GPUBuffer* m_IndexBuffer;
         uint32_t m_VertexCount;
         uint32_t m_IndexCount;
         std::vector<glm::mat4> m_InverseBindMatrices;  // COMPACT - size = usedJointCount
         std::vector<uint16_t> m_JointRemaps;           // COMPACT -> skeleton mapping
+        MeshBounds m_Bounds;
+        std::vector<Submesh> m_Submeshes;
     };
 
 }
@@ -5,7 +5,8 @@
 #include "Skeleton.h"
 #include "Animation.h"
 #include "../Platform/RenderDevice.h"
-#include <iostream>
+#include "../Core/Log.h"
+#include "../Core/Profiler.h"
 #include <fstream>
 #include <filesystem>
 #include <cstring>
@@ -21,15 +22,16 @@ namespace Resources {
 
     void ResourceManager::Init(Platform::RenderDevice* renderDevice) {
         m_RenderDevice = renderDevice;
-        std::cout << "[ResourceManager] Initialized" << std::endl;
+        LOG_CORE_INFO("[ResourceManager] Initialized");
     }
 
     void ResourceManager::Shutdown() {
         m_Resources.clear();
-        std::cout << "[ResourceManager] Shutdown" << std::endl;
+        LOG_CORE_INFO("[ResourceManager] Shutdown");
     }
 
     void ResourceManager::Update() {
+        PROFILE_SCOPE("ResourceManager::Update");
         static int frameCount = 0;
         frameCount++;
         
@@ -40,16 +42,16 @@ namespace Resources {
                 
                 // Debug log every 600 frames (approx 10s)
                 if (frameCount % 600 == 0) {
-                    // std::cout << "[ResourceManager] Checking " << path << std::endl;
+                    LOG_CORE_TRACE("[ResourceManager] Checking {}", path);
                 }
 
                 if (!ec && currentWriteTime > resource->GetLastWriteTime()) {
-                    std::cout << "[ResourceManager] Detected change in " << path << ". Reloading..." << std::endl;
+                    LOG_CORE_INFO("[ResourceManager] Detected change in {}. Reloading...", path);
                     
                     // Generic Reload Logic
                     if (resource->Reload()) {
                          resource->SetLastWriteTime(currentWriteTime);
-                         std::cout << "[ResourceManager] Reloaded " << path << std::endl;
+                         LOG_CORE_INFO("[ResourceManager] Reloaded {}", path);
                     } else {
                         // Fallback for now (Legacy Texture Reload) until all resources implement Reload()
                         auto texture = std::dynamic_pointer_cast<Texture>(resource);
@@ -68,11 +70,11 @@ namespace Resources {
                                     OakTexHeader* header = reinterpret_cast<OakTexHeader*>(data.data());
                                     if (strncmp(header->signature, "OAKT", 4) == 0) {
                                         const char* pixelData = data.data() + sizeof(OakTexHeader);
-                                        SDL_GPUTexture* gpuTexture = m_RenderDevice->CreateTexture(header->width, header->height, pixelData);
+                                        SDL_GPUTexture* gpuTexture = m_RenderDevice && m_RenderDevice->GetDevice() ? m_RenderDevice->CreateTexture(header->width, header->height, pixelData) : nullptr;
                                         if (gpuTexture) {
                                             texture->UpdateTexture(gpuTexture, header->width, header->height);
                                             resource->SetLastWriteTime(currentWriteTime);
-                                            std::cout << "[ResourceManager] Reloaded " << path << std::endl;
+                                            LOG_CORE_INFO("[ResourceManager] Reloaded {}", path);
                                         }
                                     }
                                 }
@@ -88,7 +90,7 @@ namespace Resources {
         std::ifstream file(path, std::ios::ate | std::ios::binary);
 
         if (!file.is_open()) {
-            std::cerr << "[ResourceManager] Failed to open file: " << path << std::endl;
+            LOG_CORE_ERROR("[ResourceManager] Failed to open file: {}", path);
             return {};
         }
 
@@ -156,17 +158,26 @@ namespace Resources {
 
         OakTexHeader* header = reinterpret_cast<OakTexHeader*>(data.data());
         if (strncmp(header->signature, "OAKT", 4) != 0) {
-            std::cerr << "[ResourceManager] Invalid texture signature: " << path << std::endl;
+            LOG_CORE_ERROR("[ResourceManager] Invalid texture signature: {}", path);
             return nullptr;
         }
 
         const char* pixelData = data.data() + sizeof(OakTexHeader);
+
+        // Headless or null backend: keep the metadata, there is nothing to upload to
+        if (!m_RenderDevice || m_RenderDevice->IsNull()) {
+            auto texture = std::make_shared<Texture>(nullptr, header->width, header->height, nullptr);
+            texture->m_Path = path;
+            texture->m_LastWriteTime = std::filesystem::last_write_time(path);
+            m_Resources[path] = texture;
+            return texture;
+        }
         
         // Create GPU Texture
         SDL_GPUTexture* gpuTexture = m_RenderDevice->CreateTexture(header->width, header->height, pixelData);
         if (!gpuTexture) return nullptr;
 
-        auto texture = std::make_shared<Texture>(m_RenderDevice->GetDevice(), header->width, header->height, gpuTexture);
+        auto texture = std::make_shared<Texture>(m_RenderDevice, header->width, header->height, gpuTexture);
         texture->m_Path = path;
         texture->m_LastWriteTime = std::filesystem::last_write_time(path);
         
@@ -180,7 +191,9 @@ namespace Resources {
             return std::dynamic_pointer_cast<Mesh>(m_Resources[path]);
         }
 
-        auto mesh = std::make_shared<Mesh>(m_RenderDevice->GetDevice(), nullptr, nullptr, 0, 0);
+        // The null backend has nothing to upload to, like headless
+        Platform::RenderDevice* device = m_RenderDevice && !m_RenderDevice->IsNull() ? m_RenderDevice : nullptr;
+        auto mesh = std::make_shared<Mesh>(device, nullptr, nullptr, 0, 0);
         mesh->m_Path = path;
         
         if (mesh->Reload()) {
@@ -201,7 +214,17 @@ namespace Resources {
             return std::dynamic_pointer_cast<Mesh>(m_Resources[cacheKey]);
         }
 
-        SDL_GPUDevice* device = m_RenderDevice->GetDevice();
+        MeshBounds bounds = MeshBounds::FromVertices(vertices.data(), vertices.size());
+
+        if (!m_RenderDevice || m_RenderDevice->IsNull()) {
+            // Headless or null backend: counts only, no GPU buffers
+            auto mesh = std::make_shared<Mesh>(nullptr, nullptr, nullptr,
+                static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(indices.size()));
+            mesh->SetBounds(bounds, { { 0, static_cast<uint32_t>(indices.size()), bounds } });
+            mesh->m_Path = cacheKey;
+            m_Resources[cacheKey] = mesh;
+            return mesh;
+        }
 
         uint32_t vertexDataSize = static_cast<uint32_t>(vertices.size() * sizeof(Vertex));
         uint32_t indexDataSize = static_cast<uint32_t>(indices.size() * sizeof(uint32_t));
@@ -210,70 +233,29 @@ namespace Resources {
         SDL_GPUBufferCreateInfo vertexBufferInfo = {};
         vertexBufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
         vertexBufferInfo.size = vertexDataSize;
-        SDL_GPUBuffer* vertexBuffer = SDL_CreateGPUBuffer(device, &vertexBufferInfo);
+        SDL_GPUBuffer* vertexBuffer = m_RenderDevice->CreateBuffer(&vertexBufferInfo);
 
         SDL_GPUBufferCreateInfo indexBufferInfo = {};
         indexBufferInfo.usage = SDL_GPU_BUFFERUSAGE_INDEX;
         indexBufferInfo.size = indexDataSize;
-        SDL_GPUBuffer* indexBuffer = SDL_CreateGPUBuffer(device, &indexBufferInfo);
-
-        if (!vertexBuffer || !indexBuffer) {
-            if (vertexBuffer) SDL_ReleaseGPUBuffer(device, vertexBuffer);
-            if (indexBuffer) SDL_ReleaseGPUBuffer(device, indexBuffer);
+        SDL_GPUBuffer* indexBuffer = m_RenderDevice->CreateBuffer(&indexBufferInfo);
+
+        // Upload data with the next frame
+        if (!vertexBuffer || !indexBuffer ||
+            !m_RenderDevice->UploadBuffer(vertexBuffer, 0, vertices.data(), vertexDataSize) ||
+            !m_RenderDevice->UploadBuffer(indexBuffer, 0, indices.data(), indexDataSize)) {
+            if (vertexBuffer) m_RenderDevice->ReleaseBuffer(vertexBuffer);
+            if (indexBuffer) m_RenderDevice->ReleaseBuffer(indexBuffer);
             return nullptr;
         }
 
-        // Upload data
-        uint32_t totalSize = vertexDataSize + indexDataSize;
-        SDL_GPUTransferBufferCreateInfo transferInfo = {};
-        transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-        transferInfo.size = totalSize;
-
-        SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(device, &transferInfo);
-        if (!transferBuffer) {
-            SDL_ReleaseGPUBuffer(device, vertexBuffer);
-            SDL_ReleaseGPUBuffer(device, indexBuffer);
-            return nullptr;
-        }
-
-        void* map = SDL_MapGPUTransferBuffer(device, transferBuffer, false);
-        if (map) {
-            SDL_memcpy(map, vertices.data(), vertexDataSize);
-            SDL_memcpy(static_cast<char*>(map) + vertexDataSize, indices.data(), indexDataSize);
-            SDL_UnmapGPUTransferBuffer(device, transferBuffer);
-
-            SDL_GPUCommandBuffer* cmd = SDL_AcquireGPUCommandBuffer(device);
-            SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(cmd);
-
-            SDL_GPUTransferBufferLocation source = {};
-            source.transfer_buffer = transferBuffer;
-            source.offset = 0;
-
-            SDL_GPUBufferRegion destination = {};
-            destination.buffer = vertexBuffer;
-            destination.size = vertexDataSize;
-            destination.offset = 0;
-
-            SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-
-            source.offset = vertexDataSize;
-            destination.buffer = indexBuffer;
-            destination.size = indexDataSize;
-
-            SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-
-            SDL_EndGPUCopyPass(copyPass);
-            SDL_SubmitGPUCommandBuffer(cmd);
-        }
-        SDL_ReleaseGPUTransferBuffer(device, transferBuffer);
-
-        auto mesh = std::make_shared<Mesh>(device, vertexBuffer, indexBuffer, 
+        auto mesh = std::make_shared<Mesh>(m_RenderDevice, vertexBuffer, indexBuffer, 
             static_cast<uint32_t>(vertices.size()), static_cast<uint32_t>(indices.size()));
+        mesh->SetBounds(bounds, { { 0, static_cast<uint32_t>(indices.size()), bounds } });
         mesh->m_Path = cacheKey;
         m_Resources[cacheKey] = mesh;
 
-        std::cout << "[ResourceManager] Created primitive mesh: " << name 
-                  << " (" << vertices.size() << " verts, " << indices.size() << " indices)" << std::endl;
+        LOG_CORE_DEBUG("[ResourceManager] Created primitive mesh: {} ({} verts, {} indices)", name, vertices.size(), indices.size());
         
         return mesh;
     }
@@ -287,16 +269,25 @@ namespace Resources {
                                     + "_sb" + std::to_string(storageBuffers) 
                                     + "_ub" + std::to_string(uniformBuffers);
         
-        // Debug Log
-        std::cout << "[ResourceManager] LoadShader: " << path 
-                  << " | SB: " << storageBuffers 
-                  << " | UB: " << uniformBuffers << std::endl;
+        LOG_CORE_DEBUG("[ResourceManager] LoadShader: {} | SB: {} | UB: {}", path, storageBuffers, uniformBuffers);
 
         // Check Cache with full key
         if (m_Resources.find(cacheKey) != m_Resources.end()) {
             return std::dynamic_pointer_cast<Shader>(m_Resources[cacheKey]);
         }
 
+        if (!m_RenderDevice) {
+            return nullptr;
+        }
+
+        // The null backend builds pipelines from placeholder shaders; nothing is compiled
+        if (m_RenderDevice->IsNull()) {
+            auto shader = std::make_shared<Shader>(nullptr, nullptr, stage, samplers, storageTextures, storageBuffers, uniformBuffers);
+            shader->m_Path = path;
+            m_Resources[cacheKey] = shader;
+            return shader;
+        }
+
         auto shader = std::make_shared<Shader>(m_RenderDevice->GetDevice(), nullptr, stage, samplers, storageTextures, storageBuffers, uniformBuffers);
         shader->m_Path = path;
 
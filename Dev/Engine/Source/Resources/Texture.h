@@ -6,7 +6,7 @@ namespace Resources {
 
     class Texture : public Resource {
     public:
-        Texture(SDL_GPUDevice* device, uint32_t width, uint32_t height, SDL_GPUTexture* texture);
+        Texture(Platform::RenderDevice* renderDevice, uint32_t width, uint32_t height, SDL_GPUTexture* texture);
         ~Texture();
 
         uint32_t GetWidth() const { return m_Width; }
@@ -19,7 +19,7 @@ namespace Resources {
         virtual bool Reload() override;
 
     private:
-        SDL_GPUDevice* m_Device;
+        Platform::RenderDevice* m_RenderDevice;
         uint32_t m_Width;
         uint32_t m_Height;
         SDL_GPUTexture* m_Texture;
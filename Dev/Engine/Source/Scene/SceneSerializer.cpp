@@ -3,9 +3,9 @@
 #include "../Resources/ResourceManager.h"
 #include "../Resources/Mesh.h"
 #include "../Resources/Texture.h"
+#include "../Core/Log.h"
 #include <nlohmann/json.hpp>
 #include <fstream>
-#include <iostream>
 #include <cstdint>
 
 using json = nlohmann::json;
@@ -19,7 +19,7 @@ namespace Core {
         root["scene"] = "Untitled";
         root["entities"] = json::array();
 
-        m_Scene->GetWorld().each([&](flecs::entity e, LocalTransform& t) {
+        m_Scene->GetWorld().each([&](flecs::entity e, const LocalTransform& t) {
             // Only serialize entities with names for now
             if (!e.name().length()) return;
 
@@ -27,9 +27,10 @@ namespace Core {
             entityJson["name"] = e.name().c_str();
             
             // Transform
+            glm::vec3 euler = QuatToEuler(t.rotation);
             entityJson["transform"] = {
                 {"position", {t.position.x, t.position.y, t.position.z}},
-                {"rotation", {t.rotation.x, t.rotation.y, t.rotation.z}},
+                {"rotation", {euler.x, euler.y, euler.z}},
                 {"scale", {t.scale.x, t.scale.y, t.scale.z}}
             };
 
@@ -74,11 +75,10 @@ namespace Core {
 
             // Transform
             auto t = entityJson["transform"];
-            LocalTransform transform;
-            transform.position = {t["position"][0], t["position"][1], t["position"][2]};
-            transform.rotation = {t["rotation"][0], t["rotation"][1], t["rotation"][2]};
-            transform.scale = {t["scale"][0], t["scale"][1], t["scale"][2]};
-            e.set<LocalTransform>(transform);
+            e.set<LocalTransform>(LocalTransform::FromEuler(
+                {t["position"][0], t["position"][1], t["position"][2]},
+                {t["rotation"][0], t["rotation"][1], t["rotation"][2]},
+                {t["scale"][0], t["scale"][1], t["scale"][2]}));
 
             // Sprite
             if (entityJson.contains("sprite")) {
@@ -104,6 +104,13 @@ namespace Core {
         uint32_t entityCount;
     };
 
+    // As the AssetCooker writes it: rotation in Euler degrees
+    struct OakLevelTransform {
+        glm::vec3 position;
+        glm::vec3 rotation;
+        glm::vec3 scale;
+    };
+
     bool SceneSerializer::DeserializeBinary(const std::string& filepath) {
         std::ifstream in(filepath, std::ios::binary);
         if (!in.is_open()) return false;
@@ -112,7 +119,7 @@ namespace Core {
         in.read(reinterpret_cast<char*>(&header), sizeof(OakLevelHeader));
 
         if (strncmp(header.signature, "OAKL", 4) != 0) {
-            std::cerr << "Invalid scene file signature" << std::endl;
+            LOG_CORE_ERROR("Invalid scene file signature");
             return false;
         }
 
@@ -130,9 +137,9 @@ namespace Core {
             bool hasTransform;
             in.read(reinterpret_cast<char*>(&hasTransform), sizeof(bool));
             if (hasTransform) {
-                LocalTransform transform;
-                in.read(reinterpret_cast<char*>(&transform), sizeof(LocalTransform));
-                e.set<LocalTransform>(transform);
+                OakLevelTransform transform;
+                in.read(reinterpret_cast<char*>(&transform), sizeof(OakLevelTransform));
+                e.set<LocalTransform>(LocalTransform::FromEuler(transform.position, transform.rotation, transform.scale));
             }
 
             // Sprite
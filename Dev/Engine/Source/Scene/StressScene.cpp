@@ -0,0 +1,314 @@
+#include "StressScene.h"
+#include "../Animation/AnimGraph.h"
+#include "../Components/Components.h"
+#include "../Core/Log.h"
+#include "../Resources/Animation.h"
+#include "../Resources/Mesh.h"
+#include "../Resources/ResourceManager.h"
+#include "../Resources/Skeleton.h"
+#include <nlohmann/json.hpp>
+#include <flecs.h>
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <random>
+
+using json = nlohmann::json;
+
+namespace Core {
+
+    namespace {
+        // Separate streams per category so adding lights doesn't move the meshes
+        enum Stream : uint32_t { StaticMeshes = 1, Lights, Characters, Bodies };
+
+        std::mt19937 MakeStream(uint32_t seed, Stream stream) {
+            std::seed_seq seq{ seed, static_cast<uint32_t>(stream) };
+            return std::mt19937(seq);
+        }
+
+        // The standard distributions differ between standard libraries; this doesn't, so a seed
+        // places things identically on every platform
+        float NextUnit(std::mt19937& rng) {
+            return static_cast<float>(rng() >> 8) * (1.0f / 16777216.0f);
+        }
+
+        glm::vec3 Scatter(std::mt19937& rng, float area, float height) {
+            glm::vec3 position(0.0f, height, 0.0f);
+            position.x = (NextUnit(rng) - 0.5f) * area;
+            position.z = (NextUnit(rng) - 0.5f) * area;
+            return position;
+        }
+
+        // Proportions cycle through a 4x4x4 grid so neighbouring indices look different
+        glm::vec3 BoxHalfExtents(uint32_t index) {
+            return {
+                0.25f + 0.25f * static_cast<float>(index % 4),
+                0.25f + 0.5f * static_cast<float>((index / 4) % 4),
+                0.25f + 0.25f * static_cast<float>((index / 16) % 4)
+            };
+        }
+
+        std::shared_ptr<Resources::Mesh> CreateBox(Resources::ResourceManager& resources, const std::string& name, const glm::vec3& half) {
+            struct Face { glm::vec3 normal; glm::vec3 right; glm::vec3 up; };
+            const Face faces[] = {
+                { {0, 0, 1}, {1, 0, 0}, {0, 1, 0} },
+                { {0, 0, -1}, {-1, 0, 0}, {0, 1, 0} },
+                { {1, 0, 0}, {0, 0, -1}, {0, 1, 0} },
+                { {-1, 0, 0}, {0, 0, 1}, {0, 1, 0} },
+                { {0, 1, 0}, {1, 0, 0}, {0, 0, -1} },
+                { {0, -1, 0}, {1, 0, 0}, {0, 0, 1} },
+            };
+            const glm::vec2 uvs[4] = { {0, 1}, {1, 1}, {1, 0}, {0, 0} };
+
+            std::vector<Resources::Vertex> vertices;
+            std::vector<uint32_t> indices;
+            for (const Face& face : faces) {
+                uint32_t base = static_cast<uint32_t>(vertices.size());
+                glm::vec3 center = face.normal * half;
+                glm::vec3 right = face.right * half;
+                glm::vec3 up = face.up * half;
+                const glm::vec3 corners[4] = { center - right - up, center + right - up, center + right + up, center - right + up };
+
+                for (int i = 0; i < 4; i++) {
+                    Resources::Vertex v;
+                    v.position = corners[i];
+                    v.normal = face.normal;
+                    v.uv = uvs[i];
+                    v.weights = glm::vec4(1.0f, 0.0f, 0.0f, 0.0f);
+                    v.joints = glm::vec4(0.0f);
+                    vertices.push_back(v);
+                }
+                indices.insert(indices.end(), { base, base + 1, base + 2, base, base + 2, base + 3 });
+            }
+            return resources.CreatePrimitiveMesh(name, vertices, indices);
+        }
+
+        // Clip i plays while Speed is in [i, i + 1), so a Speed spread over [0, clips) spreads the
+        // characters over every state
+        std::shared_ptr<Animation::AnimGraph> CreateClipGraph(const std::vector<std::shared_ptr<Resources::Animation>>& clips) {
+            auto graph = std::make_shared<Animation::AnimGraph>();
+            graph->AddParameter("Speed", Animation::AnimParameter::Type::Float, 0.0f);
+            for (size_t i = 0; i < clips.size(); ++i) {
+                graph->AddState("Clip" + std::to_string(i), clips[i]);
+            }
+            graph->SetDefaultState("Clip0");
+
+            for (size_t i = 1; i < clips.size(); ++i) {
+                std::string lower = "Clip" + std::to_string(i - 1);
+                std::string upper = "Clip" + std::to_string(i);
+                float threshold = static_cast<float>(i);
+                graph->AddTransition(lower, upper, 0.2f);
+                graph->AddTransitionCondition(lower, upper, "Speed", Animation::TransitionCondition::Comparison::GreaterEquals, threshold);
+                graph->AddTransition(upper, lower, 0.2f);
+                graph->AddTransitionCondition(upper, lower, "Speed", Animation::TransitionCondition::Comparison::Less, threshold);
+            }
+            return graph;
+        }
+    }
+
+    bool StressSceneSettings::FromJson(const json& root, StressSceneSettings& settings) {
+        try {
+            settings.Seed = root.value("seed", settings.Seed);
+            settings.Area = root.value("area", settings.Area);
+            settings.MeshInstances = root.value("meshInstances", settings.MeshInstances);
+            settings.UniqueMeshes = root.value("uniqueMeshes", settings.UniqueMeshes);
+            settings.MeshPaths = root.value("meshes", settings.MeshPaths);
+            settings.PointLights = root.value("pointLights", settings.PointLights);
+            settings.Characters = root.value("characters", settings.Characters);
+            settings.CharacterMesh = root.value("characterMesh", settings.CharacterMesh);
+            settings.CharacterSkeleton = root.value("characterSkeleton", settings.CharacterSkeleton);
+            settings.CharacterClips = root.value("characterClips", settings.CharacterClips);
+            settings.RigidBodies = root.value("rigidBodies", settings.RigidBodies);
+        } catch (const std::exception& e) {
+            LOG_CORE_ERROR("StressScene: invalid settings: {}", e.what());
+            return false;
+        }
+        return true;
+    }
+
+    bool StressSceneSettings::Load(const std::string& path, StressSceneSettings& settings) {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            LOG_CORE_ERROR("StressScene: could not open settings {}", path);
+            return false;
+        }
+
+        json root;
+        try {
+            file >> root;
+        } catch (const std::exception& e) {
+            LOG_CORE_ERROR("StressScene: failed to parse settings {}: {}", path, e.what());
+            return false;
+        }
+        return FromJson(root, settings);
+    }
+
+    StressSceneGenerator::StressSceneGenerator(const StressSceneSettings& settings)
+        : m_Settings(settings) {}
+
+    std::vector<StressSceneGenerator::Placement> StressSceneGenerator::PlaceStaticMeshes(uint32_t meshCount) const {
+        std::mt19937 rng = MakeStream(m_Settings.Seed, StaticMeshes);
+        std::vector<Placement> placements(m_Settings.MeshInstances);
+        for (uint32_t i = 0; i < m_Settings.MeshInstances; ++i) {
+            placements[i].mesh = i % meshCount;
+            placements[i].position = Scatter(rng, m_Settings.Area, 0.0f);
+            placements[i].yaw = NextUnit(rng) * 360.0f;
+        }
+        return placements;
+    }
+
+    void StressSceneGenerator::Generate(flecs::world& world, Resources::ResourceManager& resources) const {
+        const StressSceneSettings& s = m_Settings;
+        uint32_t meshCount = 0;
+        uint32_t characterCount = 0;
+
+        // Static meshes. Boxes sit on y = 0; loaded meshes keep their own origin
+        if (s.MeshInstances > 0) {
+            std::vector<std::shared_ptr<Resources::Mesh>> meshes;
+            std::vector<float> lift;
+            if (!s.MeshPaths.empty()) {
+                for (const std::string& path : s.MeshPaths) {
+                    meshes.push_back(resources.LoadMesh(path));
+                    lift.push_back(0.0f);
+                    if (!meshes.back()) {
+                        LOG_CORE_WARN("StressScene: could not load {}, its instances are skipped", path);
+                    }
+                }
+            } else {
+                for (uint32_t i = 0; i < std::max(s.UniqueMeshes, 1u); ++i) {
+                    glm::vec3 half = BoxHalfExtents(i);
+                    meshes.push_back(CreateBox(resources, "stress_box_" + std::to_string(i), half));
+                    lift.push_back(half.y);
+                }
+            }
+
+            for (const Placement& placement : PlaceStaticMeshes(static_cast<uint32_t>(meshes.size()))) {
+                if (!meshes[placement.mesh]) continue;
+                world.entity()
+                    .set<LocalTransform>(LocalTransform::FromEuler(placement.position + glm::vec3(0.0f, lift[placement.mesh], 0.0f), {0.0f, placement.yaw, 0.0f}))
+                    .set<MeshComponent>({ meshes[placement.mesh] });
+                meshCount++;
+            }
+        }
+
+        // Point lights
+        {
+            std::mt19937 rng = MakeStream(s.Seed, Lights);
+            for (uint32_t i = 0; i < s.PointLights; ++i) {
+                glm::vec3 position = Scatter(rng, s.Area, 0.0f);
+                // One draw per statement: argument evaluation order is unspecified
+                position.y = 1.0f + NextUnit(rng) * 4.0f;
+                glm::vec3 color;
+                color.r = 0.3f + 0.7f * NextUnit(rng);
+                color.g = 0.3f + 0.7f * NextUnit(rng);
+                color.b = 0.3f + 0.7f * NextUnit(rng);
+                float radius = 6.0f + NextUnit(rng) * 4.0f;
+                world.entity()
+                    .set<LocalTransform>({ position })
+                    .set<PointLight>({ color, 2.0f, radius, 2.0f });
+            }
+        }
+
+        // Characters: one graph shared by all, each starting at its own state and time
+        if (s.Characters > 0) {
+            std::shared_ptr<Resources::Mesh> mesh = s.CharacterMesh.empty() ? nullptr : resources.LoadMesh(s.CharacterMesh);
+            std::shared_ptr<Resources::Skeleton> skeleton = s.CharacterSkeleton.empty() ? nullptr : resources.LoadSkeleton(s.CharacterSkeleton);
+            std::vector<std::shared_ptr<Resources::Animation>> clips;
+            for (const std::string& path : s.CharacterClips) {
+                if (auto clip = resources.LoadAnimation(path)) {
+                    clips.push_back(clip);
+                }
+            }
+
+            if (mesh && skeleton && !clips.empty()) {
+                std::shared_ptr<Animation::AnimGraph> graph = CreateClipGraph(clips);
+                float duration = clips[0]->animation.duration();
+                std::mt19937 rng = MakeStream(s.Seed, Characters);
+                for (uint32_t i = 0; i < s.Characters; ++i) {
+                    glm::vec3 position = Scatter(rng, s.Area, 0.0f);
+                    float yaw = NextUnit(rng) * 360.0f;
+                    float speed = NextUnit(rng) * static_cast<float>(clips.size());
+                    float startTime = NextUnit(rng) * duration;
+
+                    AnimatorComponent animator;
+                    animator.skeleton = skeleton;
+                    animator.animGraph = graph;
+                    animator.graphInstance.Init(graph.get());
+                    animator.graphInstance.SetFloat("Speed", speed);
+                    animator.graphInstance.stateTime = startTime;
+
+                    world.entity()
+                        .set<LocalTransform>(LocalTransform::FromEuler(position, {0.0f, yaw, 0.0f}))
+                        .set<MeshComponent>({ mesh })
+                        .set<AnimatorComponent>(std::move(animator));
+                    characterCount++;
+                }
+            } else {
+                LOG_CORE_WARN("StressScene: character mesh, skeleton or clips missing, no characters spawned");
+            }
+        }
+
+        // Rigid bodies, dropped from staggered heights so they don't all land on the same tick
+        if (s.RigidBodies > 0) {
+            float halfArea = s.Area * 0.5f + 5.0f;
+            world.entity("StressGround")
+                .set<LocalTransform>({ {0.0f, -0.5f, 0.0f} })
+                .set<Collider>({ ColliderType::Box, {halfArea, 0.5f, halfArea} })
+                .set<RigidBody>({ MotionType::Static });
+
+            std::shared_ptr<Resources::Mesh> mesh = CreateBox(resources, "stress_body", glm::vec3(0.5f));
+            std::mt19937 rng = MakeStream(s.Seed, Bodies);
+            for (uint32_t i = 0; i < s.RigidBodies; ++i) {
+                glm::vec3 position = Scatter(rng, s.Area, 0.0f);
+                position.y = 1.0f + NextUnit(rng) * 20.0f;
+                float yaw = NextUnit(rng) * 360.0f;
+                world.entity()
+                    .set<LocalTransform>(LocalTransform::FromEuler(position, {0.0f, yaw, 0.0f}))
+                    .set<MeshComponent>({ mesh })
+                    .set<Collider>({ ColliderType::Box, {0.5f, 0.5f, 0.5f} })
+                    .set<RigidBody>({ MotionType::Dynamic });
+            }
+        }
+
+        LOG_CORE_INFO("StressScene: {} meshes, {} point lights, {} characters, {} rigid bodies (seed {})",
+            meshCount, s.PointLights, characterCount, s.RigidBodies, s.Seed);
+    }
+
+    bool StressSceneGenerator::WriteScene(const std::string& path) const {
+        if (m_Settings.MeshPaths.empty()) {
+            LOG_CORE_ERROR("StressScene: {} needs mesh paths, procedural meshes can't be saved", path);
+            return false;
+        }
+
+        json root;
+        root["scene"] = "Stress";
+        root["entities"] = json::array();
+
+        uint32_t index = 0;
+        for (const Placement& placement : PlaceStaticMeshes(static_cast<uint32_t>(m_Settings.MeshPaths.size()))) {
+            root["entities"].push_back({
+                {"name", "Stress" + std::to_string(index++)},
+                {"transform", {
+                    {"position", {placement.position.x, placement.position.y, placement.position.z}},
+                    {"rotation", {0.0f, placement.yaw, 0.0f}},
+                    {"scale", {1.0f, 1.0f, 1.0f}}
+                }},
+                {"mesh", {{"path", m_Settings.MeshPaths[placement.mesh]}}}
+            });
+        }
+
+        std::ofstream out(path);
+        if (!out.is_open()) {
+            LOG_CORE_ERROR("StressScene: could not open {}", path);
+            return false;
+        }
+        out << root.dump(4);
+
+        if (m_Settings.PointLights > 0 || m_Settings.Characters > 0 || m_Settings.RigidBodies > 0) {
+            LOG_CORE_WARN("StressScene: {} has the static meshes only, lights, characters and bodies are runtime-only", path);
+        }
+        LOG_CORE_INFO("StressScene: wrote {} mesh instances to {}", index, path);
+        return true;
+    }
+
+}
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <nlohmann/json_fwd.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace flecs { class world; }
+namespace Resources { class ResourceManager; }
+
+namespace Core {
+
+    // Synthetic load for scaling tests. Each category is placed from its own stream of Seed, so
+    // the same settings always build the same scene and changing one count leaves the rest in place.
+    struct StressSceneSettings {
+        uint32_t Seed = 1;
+        float Area = 50.0f;                     // Side of the square (XZ, centred on the origin) everything is scattered over
+
+        uint32_t MeshInstances = 0;             // Static meshes, spread round-robin over the unique meshes
+        uint32_t UniqueMeshes = 8;              // Procedural boxes of different proportions
+        std::vector<std::string> MeshPaths;     // .oakmesh files used instead of the boxes when set
+
+        uint32_t PointLights = 0;
+
+        uint32_t Characters = 0;                // Skinned and animated, all driven by one shared AnimGraph
+        std::string CharacterMesh;
+        std::string CharacterSkeleton;
+        std::vector<std::string> CharacterClips; // One graph state per clip, picked by a per-character Speed
+
+        uint32_t RigidBodies = 0;               // Dynamic boxes dropped onto a static ground covering the area
+
+        bool IsEmpty() const { return MeshInstances == 0 && PointLights == 0 && Characters == 0 && RigidBodies == 0; }
+
+        // Keys missing from the json keep their current value. Returns false (and logs why) when malformed
+        static bool FromJson(const nlohmann::json& json, StressSceneSettings& settings);
+        static bool Load(const std::string& path, StressSceneSettings& settings);
+    };
+
+    class StressSceneGenerator {
+    public:
+        explicit StressSceneGenerator(const StressSceneSettings& settings);
+
+        // Adds the load to the world on top of whatever is already there
+        void Generate(flecs::world& world, Resources::ResourceManager& resources) const;
+
+        // The static mesh instances as an .oakscene for the AssetCooker, placed exactly as Generate
+        // places them. Needs MeshPaths: procedural meshes and the other categories have no file form.
+        bool WriteScene(const std::string& path) const;
+
+    private:
+        struct Placement {
+            uint32_t mesh;
+            glm::vec3 position;
+            float yaw;
+        };
+        std::vector<Placement> PlaceStaticMeshes(uint32_t meshCount) const;
+
+        StressSceneSettings m_Settings;
+    };
+
+}
@@ -5,7 +5,6 @@
 #include "../Core/Log.h"
 #include <flecs.h>
 
-#include <iostream>
 
 using namespace Platform;
 
@@ -14,9 +13,15 @@ namespace Systems {
     AbilitySystem::AbilitySystem(Core::GameContext& context) 
         : m_Context(context) {}
 
+    AbilitySystem::~AbilitySystem() {
+        if (m_Context.Events) {
+            m_Context.Events->Unsubscribe(m_ActionSubscription);
+        }
+    }
+
     void AbilitySystem::Init() {
         if (m_Context.Events) {
-            m_Context.Events->Subscribe<ActionEvent>([this](const ActionEvent& event) {
+            m_ActionSubscription = m_Context.Events->Subscribe<ActionEvent>([this](const ActionEvent& event) {
                 this->OnAction(event);
             });
         }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../Core/Context.h"
+#include "../Core/EventBus.h"
 
 namespace Platform { struct ActionEvent; }
 
@@ -9,12 +10,14 @@ namespace Systems {
     class AbilitySystem {
     public:
         AbilitySystem(Core::GameContext& context);
+        ~AbilitySystem();
         
         void Init();
         void TickCooldowns(double dt);
 
     private:
         Core::GameContext& m_Context;
+        Core::EventSubscription m_ActionSubscription;
         
         void OnAction(const Platform::ActionEvent& event);
     };
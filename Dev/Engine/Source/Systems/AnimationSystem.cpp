@@ -1,18 +1,24 @@
 #include "AnimationSystem.h"
 #include "../Components/Components.h"
 #include "../Core/Log.h"
+#include "../Core/SystemScheduler.h"
 #include <ozz/animation/runtime/sampling_job.h>
 #include <ozz/animation/runtime/local_to_model_job.h>
 #include <ozz/animation/runtime/blending_job.h>
+#include <atomic>
 #include <cmath>
 
 namespace Systems {
     AnimationSystem::AnimationSystem(flecs::world& world) {
-        world.system<AnimatorComponent>("AnimationSystem")
-            .each([](flecs::entity e, AnimatorComponent& animator) {
-                static bool loggedOnce = false;
-                static bool loggedModels = false;
-                float dt = e.world().delta_time();
+        // No phase: run by the SystemScheduler, not progress().
+        // Each animator only touches its own buffers, so entities are split across threads.
+        m_System = world.system<AnimatorComponent>("AnimationSystem")
+            .kind(0)
+            .multi_threaded()
+            .each([](flecs::iter& it, size_t, AnimatorComponent& animator) {
+                static std::atomic<bool> loggedOnce = false;
+                static std::atomic<bool> loggedModels = false;
+                float dt = it.delta_time();
                 
                 if (!animator.skeleton) return;
                 
@@ -40,14 +46,13 @@ namespace Systems {
                     auto samples = animator.graphInstance.GetCurrentSamples();
                     
                     // Debug: log track vs skeleton mismatch
-                    if (!loggedOnce && !samples.empty()) {
+                    if (!samples.empty() && !loggedOnce.exchange(true)) {
                         for (size_t i = 0; i < samples.size(); i++) {
                             LOG_INFO("AnimSystem: sample[{}] tracks={}, skeleton soa_joints={}, joints={}", 
                                 i,
                                 samples[i].animation->animation.num_tracks(),
                                 num_soa_joints, num_joints);
                         }
-                        loggedOnce = true;
                     }
                     
                     if (samples.empty()) {
@@ -90,14 +95,13 @@ namespace Systems {
                         auto& sample2 = samples[1];  // Current state
                         
                         // Debug logging once
-                        if (!loggedOnce) {
+                        if (!loggedOnce.exchange(true)) {
                             LOG_INFO("AnimBlend: skeleton soa_joints={}, joints={}", 
                                 animator.skeleton->skeleton.num_soa_joints(),
                                 animator.skeleton->skeleton.num_joints());
                             LOG_INFO("AnimBlend: anim1 tracks={}, anim2 tracks={}",
                                 sample1.animation->animation.num_tracks(),
                                 sample2.animation->animation.num_tracks());
-                            loggedOnce = true;
                         }
                         
                         // Ensure contexts exist
@@ -209,7 +213,7 @@ namespace Systems {
                 }
                 
                 // Debug: check if models look reasonable
-                if (!loggedModels && animator.models.size() > 10) {
+                if (animator.models.size() > 10 && !loggedModels.exchange(true)) {
                     for (int i = 0; i < 5; i++) {
                         const auto& m = animator.models[i];
                         glm::vec3 pos(
@@ -219,8 +223,11 @@ namespace Systems {
                         );
                         LOG_INFO("Model[{}] pos: ({}, {}, {})", i, pos.x, pos.y, pos.z);
                     }
-                    loggedModels = true;
                 }
             });
     }
+
+    void AnimationSystem::Schedule(Core::SystemScheduler& scheduler) {
+        scheduler.AddSystem("AnimationSystem", Core::SystemAccess().Write<AnimatorComponent>(), m_System);
+    }
 }
@@ -1,9 +1,15 @@
 #pragma once
 #include <flecs.h>
 
+namespace Core { class SystemScheduler; }
+
 namespace Systems {
     class AnimationSystem {
     public:
         AnimationSystem(flecs::world& world);
+        void Schedule(Core::SystemScheduler& scheduler);
+
+    private:
+        flecs::system m_System;
     };
 }
@@ -1,5 +1,6 @@
 #include "CameraSystem.h"
 #include "../Components/Components.h"
+#include "../Core/SystemScheduler.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <algorithm>
 #include <cmath>
@@ -12,7 +13,9 @@ namespace Systems {
         inputPtr->SetRelativeMouseMode(true);
 
         // System for third-person orbit cameras (CameraFollowComponent)
-        world.system<LocalTransform, CameraFollowComponent, const CameraComponent>("CameraFollowSystem")
+        // Both systems have no phase: they are run by the SystemScheduler, not progress()
+        m_FollowSystem = world.system<LocalTransform, CameraFollowComponent, const CameraComponent>("CameraFollowSystem")
+            .kind(0)
             .run([inputPtr](flecs::iter& it) {
                 // Get generic input axes
                 glm::vec2 lookInput = inputPtr->GetLookInput();
@@ -77,15 +80,14 @@ namespace Systems {
 
                         // Calculate rotation to look at the smoothed target
                         glm::vec3 direction = glm::normalize(follow.currentLookAt - transform.position);
-                        transform.rotation.y = glm::degrees(atan2(-direction.x, -direction.z));
-                        transform.rotation.x = glm::degrees(asin(direction.y));
-                        transform.rotation.z = 0.0f;
+                        transform.rotation = CameraRotation(glm::degrees(asin(direction.y)), glm::degrees(atan2(-direction.x, -direction.z)));
                     }
                 }
             });
 
         // System for free-fly cameras (no CameraFollowComponent)
-        world.system<LocalTransform, const CameraComponent>("CameraFreeFlightSystem")
+        m_FreeFlightSystem = world.system<LocalTransform, const CameraComponent>("CameraFreeFlightSystem")
+            .kind(0)
             .without<CameraFollowComponent>()
             .run([inputPtr](flecs::iter& it) {
                 // Get generic input axes
@@ -105,12 +107,18 @@ namespace Systems {
 
                         LocalTransform& transform = transforms[i];
 
+                        // Yaw and pitch of the current view direction
+                        glm::vec3 view = transform.rotation * glm::vec3(0, 0, -1);
+                        float yaw = glm::degrees(atan2(-view.x, -view.z));
+                        float pitch = glm::degrees(asin(std::clamp(view.y, -1.0f, 1.0f)));
+
                         // Rotation from look input
-                        transform.rotation.y -= -lookInput.x * sensitivity;
-                        transform.rotation.x -= -lookInput.y * sensitivity;
+                        yaw -= -lookInput.x * sensitivity;
+                        pitch -= -lookInput.y * sensitivity;
 
                         // Clamp pitch
-                        transform.rotation.x = std::clamp(transform.rotation.x, -89.0f, 89.0f);
+                        pitch = std::clamp(pitch, -89.0f, 89.0f);
+                        transform.rotation = CameraRotation(pitch, yaw);
 
                         // Movement vectors
                         glm::vec3 forward = glm::vec3(0, 0, -1);
@@ -118,7 +126,7 @@ namespace Systems {
                         glm::vec3 up = glm::vec3(0, 1, 0);
 
                         // Calculate forward/right based on rotation (Y-up)
-                        glm::mat4 rot = glm::rotate(glm::mat4(1.0f), glm::radians(transform.rotation.y), glm::vec3(0, 1, 0));
+                        glm::mat4 rot = glm::rotate(glm::mat4(1.0f), glm::radians(yaw), glm::vec3(0, 1, 0));
                         forward = glm::vec3(rot * glm::vec4(forward, 0.0f));
                         right = glm::vec3(rot * glm::vec4(right, 0.0f));
 
@@ -133,4 +141,13 @@ namespace Systems {
                 }
             });
     }
+
+    void CameraSystem::Schedule(Core::SystemScheduler& scheduler) {
+        scheduler.AddSystem("CameraFollowSystem",
+            Core::SystemAccess().Write<LocalTransform, CameraFollowComponent>().Read<CameraComponent>(),
+            m_FollowSystem);
+        scheduler.AddSystem("CameraFreeFlightSystem",
+            Core::SystemAccess().Write<LocalTransform>().Read<CameraComponent, CameraFollowComponent>(),
+            m_FreeFlightSystem);
+    }
 }
@@ -2,9 +2,16 @@
 #include <flecs.h>
 #include "../Platform/Input.h"
 
+namespace Core { class SystemScheduler; }
+
 namespace Systems {
     class CameraSystem {
     public:
         CameraSystem(flecs::world& world, Platform::Input& input);
+        void Schedule(Core::SystemScheduler& scheduler);
+
+    private:
+        flecs::system m_FollowSystem;
+        flecs::system m_FreeFlightSystem;
     };
 }
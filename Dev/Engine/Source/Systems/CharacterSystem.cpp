@@ -1,5 +1,6 @@
 #include "CharacterSystem.h"
 #include "../Components/Components.h"
+#include "../Core/SystemScheduler.h"
 #include <glm/gtc/matrix_transform.hpp>
 #include <algorithm>
 #include <cmath>
@@ -8,10 +9,17 @@ namespace Systems {
     CharacterSystem::CharacterSystem(flecs::world& world, Platform::Input& input) {
         Platform::Input* inputPtr = &input;
 
+        // Cached once; queries can't be created while the scheduler has the world in readonly mode
+        auto cameraQuery = world.query<const CameraFollowComponent, const CameraComponent>();
+
         // System to handle character movement based on input
         // Movement is relative to the camera's facing direction
-        world.system<LocalTransform, CharacterController>("CharacterMovementSystem")
-            .run([inputPtr, &world](flecs::iter& it) {
+        // No phase: run by the SystemScheduler, not progress().
+        // Characters only write their own components, so entities are split across threads.
+        m_System = world.system<LocalTransform, CharacterController>("CharacterMovementSystem")
+            .kind(0)
+            .multi_threaded()
+            .run([inputPtr, cameraQuery](flecs::iter& it) {
                 // Get generic input axes
                 glm::vec2 moveInput = inputPtr->GetMoveInput();
                 bool isSprinting = inputPtr->IsSprinting();
@@ -19,7 +27,7 @@ namespace Systems {
 
                 // Get the camera yaw for movement direction
                 float cameraYaw = 0.0f;
-                world.query<const CameraFollowComponent, const CameraComponent>()
+                cameraQuery.iter(it.world())
                     .each([&](flecs::entity e, const CameraFollowComponent& follow, const CameraComponent& cam) {
                         if (cam.isPrimary) {
                             cameraYaw = follow.yaw;
@@ -76,7 +84,8 @@ namespace Systems {
 
                         // Smoothly rotate character to face movement direction
                         if (hasInput) {
-                            float currentYaw = transform.rotation.y;
+                            glm::vec3 facing = transform.rotation * glm::vec3(0, 0, 1);
+                            float currentYaw = glm::degrees(atan2(facing.x, facing.z));
                             float targetYaw = controller.targetYaw;
 
                             // Handle angle wrapping
@@ -86,30 +95,30 @@ namespace Systems {
 
                             // Smooth rotation
                             float rotationStep = controller.turnSpeed * dt * 60.0f; // Scale by 60 for reasonable feel
-                            if (std::abs(diff) < rotationStep) {
-                                transform.rotation.y = targetYaw;
-                            } else {
-                                transform.rotation.y += (diff > 0 ? rotationStep : -rotationStep);
-                            }
-
-                            // Normalize rotation
-                            while (transform.rotation.y > 180.0f) transform.rotation.y -= 360.0f;
-                            while (transform.rotation.y < -180.0f) transform.rotation.y += 360.0f;
+                            float yaw = std::abs(diff) < rotationStep ? targetYaw : currentYaw + (diff > 0 ? rotationStep : -rotationStep);
+                            transform.rotation = glm::angleAxis(glm::radians(yaw), glm::vec3(0, 1, 0));
                         }
                         
                         // Update AnimGraph parameters if entity has an animator
                         flecs::entity entity = it.entity(i);
-                        if (entity.has<AnimatorComponent>()) {
-                            AnimatorComponent& animator = entity.ensure<AnimatorComponent>();
-                            if (animator.animGraph) {
+                        if (AnimatorComponent* animator = entity.try_get_mut<AnimatorComponent>()) {
+                            if (animator->animGraph) {
                                 float speed = glm::length(controller.velocity);
-                                animator.graphInstance.SetBool("IsMoving", hasInput);
-                                animator.graphInstance.SetBool("IsRunning", isSprinting && hasInput);
-                                animator.graphInstance.SetFloat("Speed", speed);
+                                animator->graphInstance.SetBool("IsMoving", hasInput);
+                                animator->graphInstance.SetBool("IsRunning", isSprinting && hasInput);
+                                animator->graphInstance.SetFloat("Speed", speed);
                             }
                         }
                     }
                 }
             });
     }
+
+    void CharacterSystem::Schedule(Core::SystemScheduler& scheduler) {
+        scheduler.AddSystem("CharacterMovementSystem",
+            Core::SystemAccess()
+                .Write<LocalTransform, CharacterController, AnimatorComponent>()
+                .Read<CameraFollowComponent, CameraComponent>(),
+            m_System);
+    }
 }
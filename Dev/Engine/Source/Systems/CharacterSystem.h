@@ -2,9 +2,15 @@
 #include <flecs.h>
 #include "../Platform/Input.h"
 
+namespace Core { class SystemScheduler; }
+
 namespace Systems {
     class CharacterSystem {
     public:
         CharacterSystem(flecs::world& world, Platform::Input& input);
+        void Schedule(Core::SystemScheduler& scheduler);
+
+    private:
+        flecs::system m_System;
     };
 }
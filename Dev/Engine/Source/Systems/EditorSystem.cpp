@@ -1,6 +1,5 @@
 #include "EditorSystem.h"
 #include <imgui.h>
-#include <iostream>
 
 namespace Systems {
 
@@ -0,0 +1,119 @@
+#include "FrustumCulling.h"
+#include "FrustumCullingKernel.h"
+#include "../Resources/Mesh.h"
+#include <cmath>
+
+namespace Systems {
+
+    namespace {
+        // Half size given to meshes without bounds: large enough that no plane rejects it,
+        // small enough that the plane distances stay finite
+        constexpr float UnboundedExtent = 1e30f;
+
+        // Planes followed by their absolute normals, as the kernels read them
+        void PackPlanes(const Frustum& frustum, float* out) {
+            for (uint32_t p = 0; p < CullingKernel::PlaneCount; ++p) {
+                const glm::vec4& plane = frustum.planes[p];
+                out[p * 4 + 0] = plane.x;
+                out[p * 4 + 1] = plane.y;
+                out[p * 4 + 2] = plane.z;
+                out[p * 4 + 3] = plane.w;
+                float* absNormal = out + CullingKernel::PlaneCount * 4 + p * 3;
+                absNormal[0] = std::abs(plane.x);
+                absNormal[1] = std::abs(plane.y);
+                absNormal[2] = std::abs(plane.z);
+            }
+        }
+    }
+
+    void CullBounds::Resize(uint32_t count) {
+        centerX.resize(count);
+        centerY.resize(count);
+        centerZ.resize(count);
+        extentX.resize(count);
+        extentY.resize(count);
+        extentZ.resize(count);
+    }
+
+    void CullBounds::Clear() {
+        Resize(0);
+    }
+
+    void CullBounds::Set(uint32_t index, const glm::vec3& center, const glm::vec3& extent) {
+        centerX[index] = center.x;
+        centerY[index] = center.y;
+        centerZ[index] = center.z;
+        extentX[index] = extent.x;
+        extentY[index] = extent.y;
+        extentZ[index] = extent.z;
+    }
+
+    void CullBounds::Set(uint32_t index, const glm::mat4& model, const Resources::MeshBounds& bounds) {
+        if (bounds.IsEmpty()) {
+            Set(index, glm::vec3(model[3]), glm::vec3(UnboundedExtent));
+            return;
+        }
+
+        // The transformed box's extent along each world axis is |M| * extent (Arvo)
+        glm::vec3 extent = (bounds.max - bounds.min) * 0.5f;
+        glm::vec3 center = glm::vec3(model * glm::vec4((bounds.min + bounds.max) * 0.5f, 1.0f));
+        glm::vec3 worldExtent = glm::abs(glm::vec3(model[0])) * extent.x
+                              + glm::abs(glm::vec3(model[1])) * extent.y
+                              + glm::abs(glm::vec3(model[2])) * extent.z;
+        Set(index, center, worldExtent);
+    }
+
+    Frustum Frustum::FromMatrix(const glm::mat4& viewProj) {
+        // Rows of the matrix (Gribb & Hartmann); glm is column-major
+        glm::vec4 row[4];
+        for (int r = 0; r < 4; ++r) {
+            row[r] = glm::vec4(viewProj[0][r], viewProj[1][r], viewProj[2][r], viewProj[3][r]);
+        }
+
+        Frustum frustum;
+        frustum.planes[0] = row[3] + row[0]; // Left:   -w <= x
+        frustum.planes[1] = row[3] - row[0]; // Right:   x <= w
+        frustum.planes[2] = row[3] + row[1]; // Bottom: -w <= y
+        frustum.planes[3] = row[3] - row[1]; // Top:     y <= w
+        frustum.planes[4] = row[2];          // Near:    0 <= z
+        frustum.planes[5] = row[3] - row[2]; // Far:     z <= w
+        return frustum;
+    }
+
+    bool FrustumCulling::IsVisibleScalar(const Frustum& frustum, const glm::vec3& center, const glm::vec3& extent) {
+        for (const glm::vec4& plane : frustum.planes) {
+            glm::vec3 normal = glm::vec3(plane);
+            float dist = glm::dot(normal, center) + plane.w + glm::dot(glm::abs(normal), extent);
+            if (dist < 0.0f) return false;
+        }
+        return true;
+    }
+
+    void FrustumCulling::Cull(const Frustum& frustum, const CullBounds& bounds, uint32_t begin, uint32_t end, uint8_t* visible) {
+        Cull(TransformBatch::GetBestPath(), frustum, bounds, begin, end, visible);
+    }
+
+    void FrustumCulling::Cull(TransformBatch::Path path, const Frustum& frustum, const CullBounds& bounds, uint32_t begin, uint32_t end, uint8_t* visible) {
+#if OAKEN_TRANSFORM_SIMD
+        if (path != TransformBatch::Path::Scalar) {
+            float planes[CullingKernel::PlaneFloats];
+            PackPlanes(frustum, planes);
+            CullingKernel::BoxArrays boxes = { {
+                bounds.centerX.data(), bounds.centerY.data(), bounds.centerZ.data(),
+                bounds.extentX.data(), bounds.extentY.data(), bounds.extentZ.data()
+            } };
+            if (path == TransformBatch::Path::AVX2 && TransformBatch::IsSupported(TransformBatch::Path::AVX2)) {
+                CullingKernel::CullAVX2(planes, boxes, begin, end, visible);
+            } else {
+                CullingKernel::Cull<CullingKernel::SSE2>(planes, boxes, begin, end, visible);
+            }
+            return;
+        }
+#endif
+        for (uint32_t i = begin; i < end; ++i) {
+            glm::vec3 center(bounds.centerX[i], bounds.centerY[i], bounds.centerZ[i]);
+            glm::vec3 extent(bounds.extentX[i], bounds.extentY[i], bounds.extentZ[i]);
+            visible[i] = IsVisibleScalar(frustum, center, extent) ? 1 : 0;
+        }
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "TransformBatch.h"
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Resources { struct MeshBounds; }
+
+namespace Systems {
+
+    // World-space axis-aligned boxes as separate arrays, the layout the SIMD tests load from
+    struct CullBounds {
+        std::vector<float> centerX, centerY, centerZ;
+        std::vector<float> extentX, extentY, extentZ;  // Half sizes
+
+        uint32_t Size() const { return static_cast<uint32_t>(centerX.size()); }
+        void Resize(uint32_t count);
+        void Clear();
+
+        // The box of `bounds` under `model`. Meshes without bounds get a box no plane rejects.
+        void Set(uint32_t index, const glm::mat4& model, const Resources::MeshBounds& bounds);
+        void Set(uint32_t index, const glm::vec3& center, const glm::vec3& extent);
+    };
+
+    // Six planes (left, right, bottom, top, near, far) of a clip space with depth 0..1, the one every
+    // projection in the engine uses. Normals point inwards and aren't normalized: a point p is inside
+    // a plane when dot(xyz, p) + w >= 0.
+    struct Frustum {
+        glm::vec4 planes[6];
+
+        static Frustum FromMatrix(const glm::mat4& viewProj);
+    };
+
+    // Box-against-frustum tests in blocks of 4 (SSE2) or 8 (AVX2) boxes, picked with the same
+    // CPU check as TransformBatch. Conservative: a box is only rejected when it is entirely behind
+    // one plane, so a few boxes near the frustum's corners are kept.
+    class FrustumCulling {
+    public:
+        // visible[i] = 1 when box i of [begin, end) may be inside, 0 when it is not
+        static void Cull(const Frustum& frustum, const CullBounds& bounds, uint32_t begin, uint32_t end, uint8_t* visible);
+        static void Cull(TransformBatch::Path path, const Frustum& frustum, const CullBounds& bounds, uint32_t begin, uint32_t end, uint8_t* visible);
+
+        static bool IsVisibleScalar(const Frustum& frustum, const glm::vec3& center, const glm::vec3& extent);
+    };
+}
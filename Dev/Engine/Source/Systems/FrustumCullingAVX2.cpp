@@ -0,0 +1,15 @@
+// Built with AVX2 and FMA enabled; FrustumCulling only calls into it after checking the CPU.
+#include "FrustumCullingKernel.h"
+
+#if OAKEN_TRANSFORM_SIMD
+namespace Systems::CullingKernel {
+    void CullAVX2(const float* planes, const BoxArrays& boxes, uint32_t begin, uint32_t end, uint8_t* visible) {
+#ifdef __AVX2__
+        Cull<AVX2>(planes, boxes, begin, end, visible);
+#else
+        // Compiler without the per-file AVX2 flag; still correct, just narrower
+        Cull<SSE2>(planes, boxes, begin, end, visible);
+#endif
+    }
+}
+#endif
@@ -0,0 +1,126 @@
+#pragma once
+
+// Internal to FrustumCulling: the box-against-planes test, written once against a small ops interface
+// and instantiated per instruction set (SSE2 in FrustumCulling.cpp, AVX2 in FrustumCullingAVX2.cpp,
+// which is built with AVX2 enabled).
+//
+// Works on raw floats: planes are 6 x (nx, ny, nz, d) followed by their 6 absolute normals, and boxes
+// come as six separate arrays (centre x y z, half extent x y z).
+
+#include "TransformBatchKernel.h"
+#include <cstdint>
+
+namespace Systems::CullingKernel {
+
+    constexpr uint32_t PlaneCount = 6;
+    constexpr uint32_t PlaneFloats = PlaneCount * 4 + PlaneCount * 3;
+
+    // The box arrays in order: centre x, y, z, then extent x, y, z
+    struct BoxArrays {
+        const float* columns[6];
+    };
+
+#if OAKEN_TRANSFORM_SIMD
+
+    // Defined in FrustumCullingAVX2.cpp. Only call when the CPU supports AVX2.
+    void CullAVX2(const float* planes, const BoxArrays& boxes, uint32_t begin, uint32_t end, uint8_t* visible);
+
+    // Internal linkage for the same reason as TransformKernel's ops: one copy per instruction set
+    namespace {
+
+    struct SSE2 {
+        using F = __m128;
+        static constexpr uint32_t Width = 4;
+
+        static F Set(float v) { return _mm_set1_ps(v); }
+        static F LoadU(const float* p) { return _mm_loadu_ps(p); }
+        static F Add(F a, F b) { return _mm_add_ps(a, b); }
+        static F MulAdd(F a, F b, F c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+        static F Or(F a, F b) { return _mm_or_ps(a, b); }
+        static F LessThan(F a, F b) { return _mm_cmplt_ps(a, b); }
+        static uint32_t MoveMask(F v) { return static_cast<uint32_t>(_mm_movemask_ps(v)); }
+    };
+
+#ifdef __AVX2__
+    struct AVX2 {
+        using F = __m256;
+        static constexpr uint32_t Width = 8;
+
+        static F Set(float v) { return _mm256_set1_ps(v); }
+        static F LoadU(const float* p) { return _mm256_loadu_ps(p); }
+        static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+        static F MulAdd(F a, F b, F c) { return _mm256_fmadd_ps(a, b, c); }
+        static F Or(F a, F b) { return _mm256_or_ps(a, b); }
+        static F LessThan(F a, F b) { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+        static uint32_t MoveMask(F v) { return static_cast<uint32_t>(_mm256_movemask_ps(v)); }
+    };
+#endif
+
+    // Ops::Width boxes starting at `columns[k] + 0`: a box is outside when, for some plane,
+    // dot(n, centre) + d + dot(|n|, extent) < 0. Returns a bit per lane, set when the box is outside.
+    template<typename Ops>
+    inline uint32_t OutsideBlock(const float* planes, const float* const* columns) {
+        using F = typename Ops::F;
+
+        F cx = Ops::LoadU(columns[0]);
+        F cy = Ops::LoadU(columns[1]);
+        F cz = Ops::LoadU(columns[2]);
+        F ex = Ops::LoadU(columns[3]);
+        F ey = Ops::LoadU(columns[4]);
+        F ez = Ops::LoadU(columns[5]);
+
+        const float* absNormals = planes + PlaneCount * 4;
+        F zero = Ops::Set(0.0f);
+        F outside = zero;
+        for (uint32_t p = 0; p < PlaneCount; ++p) {
+            const float* plane = planes + p * 4;
+            const float* absNormal = absNormals + p * 3;
+            F dist = Ops::MulAdd(Ops::Set(plane[0]), cx, Ops::Set(plane[3]));
+            dist = Ops::MulAdd(Ops::Set(plane[1]), cy, dist);
+            dist = Ops::MulAdd(Ops::Set(plane[2]), cz, dist);
+            dist = Ops::MulAdd(Ops::Set(absNormal[0]), ex, dist);
+            dist = Ops::MulAdd(Ops::Set(absNormal[1]), ey, dist);
+            dist = Ops::MulAdd(Ops::Set(absNormal[2]), ez, dist);
+            outside = Ops::Or(outside, Ops::LessThan(dist, zero));
+        }
+        return Ops::MoveMask(outside);
+    }
+
+    // visible[i] = 1 for boxes in [begin, end) touching the frustum, 0 for the rest
+    template<typename Ops>
+    inline void Cull(const float* planes, const BoxArrays& boxes, uint32_t begin, uint32_t end, uint8_t* visible) {
+        constexpr uint32_t W = Ops::Width;
+        const float* columns[6];
+
+        uint32_t i = begin;
+        for (; i + W <= end; i += W) {
+            for (uint32_t k = 0; k < 6; ++k) {
+                columns[k] = boxes.columns[k] + i;
+            }
+            uint32_t outside = OutsideBlock<Ops>(planes, columns);
+            for (uint32_t lane = 0; lane < W; ++lane) {
+                visible[i + lane] = ((outside >> lane) & 1) ? 0 : 1;
+            }
+        }
+        if (i == end) return;
+
+        // The tail goes through the stack so nothing past `end` is read
+        alignas(32) float tail[6][W] = {};
+        uint32_t lanes = end - i;
+        for (uint32_t k = 0; k < 6; ++k) {
+            for (uint32_t lane = 0; lane < lanes; ++lane) {
+                tail[k][lane] = boxes.columns[k][i + lane];
+            }
+            columns[k] = tail[k];
+        }
+        uint32_t outside = OutsideBlock<Ops>(planes, columns);
+        for (uint32_t lane = 0; lane < lanes; ++lane) {
+            visible[i + lane] = ((outside >> lane) & 1) ? 0 : 1;
+        }
+    }
+
+    }
+
+#endif
+
+}
@@ -1,11 +1,12 @@
 #include "PhysicsSystem.h"
 #include "../Components/Components.h"
 #include "../Core/Log.h"
+#include "../Core/JobSystem.h"
+#include "../Core/Profiler.h"
 
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
-#include <glm/gtx/euler_angles.hpp>
 
 // Jolt includes - must be in specific order
 #include <Jolt/Jolt.h>
@@ -15,6 +16,9 @@
 #include <Jolt/Core/Factory.h>
 #include <Jolt/Core/TempAllocator.h>
 #include <Jolt/Core/JobSystemSingleThreaded.h>
+#include <Jolt/Core/JobSystemThreadPool.h>
+#include <Jolt/Core/JobSystemWithBarrier.h>
+#include <Jolt/Core/FixedSizeFreeList.h>
 #include <Jolt/Physics/PhysicsSettings.h>
 #include <Jolt/Physics/PhysicsSystem.h>
 #include <Jolt/Physics/Collision/Shape/BoxShape.h>
@@ -27,6 +31,8 @@
 #include <Jolt/Physics/Body/BodyLock.h>
 #include <Jolt/Physics/Character/CharacterVirtual.h>
 
+#include <algorithm>
+#include <chrono>
 #include <cstdarg>
 #include <thread>
 
@@ -51,6 +57,69 @@ static bool AssertFailedImpl(const char* expression, const char* message, const
 }
 #endif
 
+// Runs Jolt jobs on the engine's shared worker pool instead of spawning Jolt's own threads.
+// JobSystemWithBarrier takes care of barriers/dependencies; we only need job storage and dispatch.
+class EngineJobSystemImpl final : public JobSystemWithBarrier {
+public:
+    EngineJobSystemImpl(Core::JobSystem& jobs, uint maxJobs, uint maxBarriers, int maxConcurrency)
+        : JobSystemWithBarrier(maxBarriers), m_Jobs(jobs), m_MaxConcurrency(maxConcurrency) {
+        m_JobPool.Init(maxJobs, maxJobs);
+    }
+
+    virtual ~EngineJobSystemImpl() override {
+        // Workers may still hold references to jobs the barrier already ran
+        m_Jobs.Wait(m_Outstanding);
+    }
+
+    virtual int GetMaxConcurrency() const override { return m_MaxConcurrency; }
+
+    virtual JobHandle CreateJob(const char* name, ColorArg color, const JobFunction& jobFunction, uint32 numDependencies = 0) override {
+        uint32 index;
+        for (;;) {
+            index = m_JobPool.ConstructObject(name, color, this, jobFunction, numDependencies);
+            if (index != JobPool::cInvalidObjectIndex) break;
+            JPH_ASSERT(false, "No jobs available!");
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+        }
+        Job* job = &m_JobPool.Get(index);
+
+        // Construct the handle before queuing so the job can't be freed underneath us
+        JobHandle handle(job);
+        if (numDependencies == 0) {
+            QueueJob(job);
+        }
+        return handle;
+    }
+
+protected:
+    virtual void QueueJob(Job* job) override {
+        // Reference is released once the worker has run it; the barrier may have executed it already
+        job->AddRef();
+        m_Jobs.Execute([job]() {
+            job->Execute();
+            job->Release();
+        }, &m_Outstanding);
+    }
+
+    virtual void QueueJobs(Job** jobs, uint numJobs) override {
+        for (uint i = 0; i < numJobs; ++i) {
+            QueueJob(jobs[i]);
+        }
+    }
+
+    virtual void FreeJob(Job* job) override {
+        m_JobPool.DestructObject(job);
+    }
+
+private:
+    using JobPool = FixedSizeFreeList<Job>;
+
+    Core::JobSystem& m_Jobs;
+    Core::JobCounter m_Outstanding;
+    JobPool m_JobPool;
+    int m_MaxConcurrency;
+};
+
 // BroadPhaseLayerInterface implementation
 class BroadPhaseLayerInterfaceImpl final : public BroadPhaseLayerInterface {
 public:
@@ -178,13 +247,10 @@ namespace Systems {
         // Register all Jolt physics types
         RegisterTypes();
 
-        // Allocator for temporary allocations during physics update (10MB)
-        m_TempAllocator = std::make_unique<TempAllocatorImpl>(10 * 1024 * 1024);
+        // Allocator for temporary allocations during physics update (32MB, enough for ~10k active bodies)
+        m_TempAllocator = std::make_unique<TempAllocatorImpl>(32 * 1024 * 1024);
 
-        // Job system with threads
-        // Job system - use single-threaded for now (thread pool has CRT linkage issues)
-        m_JobSystem = std::make_unique<JobSystemSingleThreaded>(cMaxPhysicsJobs);
-        LOG_CORE_INFO("Jolt using single-threaded job system");
+        CreateJobSystem();
 
         // Create layer interfaces
         m_BroadPhaseLayerInterface = std::make_unique<BroadPhaseLayerInterfaceImpl>();
@@ -195,7 +261,7 @@ namespace Systems {
         const uint cMaxBodies = 65536;
         const uint cNumBodyMutexes = 0; // Default
         const uint cMaxBodyPairs = 65536;
-        const uint cMaxContactConstraints = 10240;
+        const uint cMaxContactConstraints = 65536;
 
         m_PhysicsSystem = std::make_unique<JPH::PhysicsSystem>();
         m_PhysicsSystem->Init(
@@ -216,6 +282,36 @@ namespace Systems {
         LOG_CORE_INFO("Jolt Physics initialized successfully");
     }
 
+    void PhysicsSystem::CreateJobSystem() {
+        // Only called between steps, so nothing can be using the old one
+        m_JobSystem.reset();
+
+        Core::JobSystem* jobs = m_Context.Jobs;
+        uint32_t available = jobs ? jobs->GetThreadCount() : std::max(1u, std::thread::hardware_concurrency());
+        uint32_t threadCount = m_ThreadCount == 0 ? available : std::min(m_ThreadCount, available);
+
+        if (threadCount <= 1) {
+            m_JobSystem = std::make_unique<JobSystemSingleThreaded>(cMaxPhysicsJobs);
+            LOG_CORE_INFO("Jolt using single-threaded job system");
+        } else if (jobs && jobs->IsInitialized()) {
+            m_JobSystem = std::make_unique<EngineJobSystemImpl>(*jobs, cMaxPhysicsJobs, cMaxPhysicsBarriers,
+                                                                static_cast<int>(threadCount));
+            LOG_CORE_INFO("Jolt using engine job system ({} threads)", threadCount);
+        } else {
+            // No engine pool (tools/tests); let Jolt run its own workers next to the calling thread
+            m_JobSystem = std::make_unique<JobSystemThreadPool>(cMaxPhysicsJobs, cMaxPhysicsBarriers,
+                                                                static_cast<int>(threadCount) - 1);
+            LOG_CORE_INFO("Jolt using thread pool job system ({} threads)", threadCount);
+        }
+    }
+
+    void PhysicsSystem::SetThreadCount(uint32_t threadCount) {
+        m_ThreadCount = threadCount;
+        if (m_Initialized) {
+            CreateJobSystem();
+        }
+    }
+
     void PhysicsSystem::Shutdown() {
         if (!m_Initialized) return;
 
@@ -251,26 +347,39 @@ namespace Systems {
 
     void PhysicsSystem::Step(float dt) {
         if (!m_Initialized || dt <= 0.0f) return;
+        PROFILE_SCOPE("Physics::Step");
 
         // Sync new/changed bodies to physics
-        SyncBodiesToPhysics();
+        {
+            PROFILE_SCOPE("Physics::SyncBodies");
+            SyncBodiesToPhysics();
+        }
 
         // Update character physics first (they drive their own movement)
-        UpdateCharacterPhysics(dt);
+        {
+            PROFILE_SCOPE("Physics::Characters");
+            UpdateCharacterPhysics(dt);
+        }
 
         // Step the physics simulation
-        m_PhysicsSystem->Update(dt, m_CollisionSteps, m_TempAllocator.get(), m_JobSystem.get());
+        {
+            PROFILE_SCOPE("Physics::Simulate");
+            m_PhysicsSystem->Update(dt, m_CollisionSteps, m_TempAllocator.get(), m_JobSystem.get());
+        }
 
         // Sync physics results back to ECS transforms
-        SyncPhysicsToTransforms();
+        {
+            PROFILE_SCOPE("Physics::SyncTransforms");
+            SyncPhysicsToTransforms();
+        }
     }
 
     void PhysicsSystem::SyncBodiesToPhysics() {
         BodyInterface& bodyInterface = m_PhysicsSystem->GetBodyInterface();
 
         // Query all entities with Collider + RigidBody that don't have a body yet
-        m_Context.World->query<LocalTransform, Collider, RigidBody>()
-            .each([&](flecs::entity entity, LocalTransform& transform, Collider& collider, RigidBody& rb) {
+        m_Context.World->query<const LocalTransform, const Collider, RigidBody>()
+            .each([&](flecs::entity entity, const LocalTransform& transform, const Collider& collider, RigidBody& rb) {
             if (rb.bodyId == 0xFFFFFFFF) {
                 // Create a new body
                 rb.bodyId = CreateBody(entity);
@@ -281,27 +390,38 @@ namespace Systems {
     void PhysicsSystem::SyncPhysicsToTransforms() {
         BodyInterface& bodyInterface = m_PhysicsSystem->GetBodyInterface();
 
-        // Update transforms for dynamic bodies
+        // Update transforms for dynamic bodies. Tables where nothing moved are skipped, so they
+        // aren't marked changed and TransformSystem leaves them alone.
         m_Context.World->query<LocalTransform, const RigidBody>()
-            .each([&](flecs::entity entity, LocalTransform& transform, const RigidBody& rb) {
-            if (rb.bodyId == 0xFFFFFFFF) return;
-            if (rb.motionType == MotionType::Static) return; // Static bodies don't move
-
-            BodyID bodyId(rb.bodyId);
-            if (!bodyInterface.IsActive(bodyId)) return;
-
-            // Get position and rotation from Jolt
-            RVec3 position = bodyInterface.GetPosition(bodyId);
-            Quat rotation = bodyInterface.GetRotation(bodyId);
-
-            // Update ECS transform
-            transform.position = glm::vec3(position.GetX(), position.GetY(), position.GetZ());
-
-            // Convert quaternion to Euler angles
-            // Note: This is a simplified conversion, may have gimbal lock issues
-            glm::quat q(rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ());
-            glm::vec3 euler = glm::degrees(glm::eulerAngles(q));
-            transform.rotation = euler;
+            .run([&](flecs::iter& it) {
+            while (it.next()) {
+                auto transforms = it.field<LocalTransform>(0);
+                auto bodies = it.field<const RigidBody>(1);
+                bool moved = false;
+
+                for (auto i : it) {
+                    const RigidBody& rb = bodies[i];
+                    if (rb.bodyId == 0xFFFFFFFF) continue;
+                    if (rb.motionType == MotionType::Static) continue; // Static bodies don't move
+
+                    BodyID bodyId(rb.bodyId);
+                    if (!bodyInterface.IsActive(bodyId)) continue;
+
+                    // Get position and rotation from Jolt
+                    RVec3 position = bodyInterface.GetPosition(bodyId);
+                    Quat rotation = bodyInterface.GetRotation(bodyId);
+
+                    // Update ECS transform
+                    LocalTransform& transform = transforms[i];
+                    transform.position = glm::vec3(position.GetX(), position.GetY(), position.GetZ());
+                    transform.rotation = glm::quat(rotation.GetW(), rotation.GetX(), rotation.GetY(), rotation.GetZ());
+                    moved = true;
+                }
+
+                if (!moved) {
+                    it.skip();
+                }
+            }
         });
     }
 
@@ -421,8 +541,7 @@ namespace Systems {
                        transform.position.y + collider.offset.y,
                        transform.position.z + collider.offset.z);
 
-        // Convert Euler angles to quaternion
-        glm::quat q = glm::quat(glm::radians(transform.rotation));
+        const glm::quat& q = transform.rotation;
         Quat rotation(q.x, q.y, q.z, q.w);
 
         BodyCreationSettings bodySettings(shapeResult.Get(), position, rotation, joltMotionType, layer);
@@ -446,7 +565,7 @@ namespace Systems {
         }
 
         m_BodyToEntity[bodyId.GetIndexAndSequenceNumber()] = entity;
-        LOG_CORE_INFO("Created physics body {} for entity", bodyId.GetIndexAndSequenceNumber());
+        LOG_CORE_TRACE("Created physics body {} for entity", bodyId.GetIndexAndSequenceNumber());
 
         return bodyId.GetIndexAndSequenceNumber();
     }
@@ -491,7 +610,7 @@ namespace Systems {
         CharacterVirtual* character = new CharacterVirtual(&settings, position, rotation, m_PhysicsSystem.get());
         m_Characters.push_back(character);
 
-        LOG_CORE_INFO("Created character physics for entity");
+        LOG_CORE_DEBUG("Created character physics for entity");
         return character;
     }
 
@@ -534,6 +653,10 @@ namespace Systems {
         return false;
     }
 
+    uint32_t PhysicsSystem::GetBodyCount() const {
+        return m_Initialized ? m_PhysicsSystem->GetNumBodies() : 0;
+    }
+
     void PhysicsSystem::SetGravity(const glm::vec3& gravity) {
         m_Gravity = gravity;
         if (m_Initialized) {
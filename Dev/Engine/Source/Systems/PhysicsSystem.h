@@ -10,7 +10,7 @@
 namespace JPH {
     class PhysicsSystem;
     class TempAllocatorImpl;
-    class JobSystemSingleThreaded;
+    class JobSystem;
     class BroadPhaseLayerInterface;
     class ObjectVsBroadPhaseLayerFilter;
     class ObjectLayerPairFilter;
@@ -75,12 +75,20 @@ namespace Systems {
         void SetGravity(const glm::vec3& gravity);
         glm::vec3 GetGravity() const;
 
+        // Number of threads Jolt may use (0 = every engine worker + the calling thread, 1 = single-threaded)
+        void SetThreadCount(uint32_t threadCount);
+        uint32_t GetThreadCount() const { return m_ThreadCount; }
+
+        uint32_t GetBodyCount() const;
+
     private:
+        void CreateJobSystem();
+
         Core::GameContext& m_Context;
         
         // Jolt systems
         std::unique_ptr<JPH::TempAllocatorImpl> m_TempAllocator;
-        std::unique_ptr<JPH::JobSystemSingleThreaded> m_JobSystem;
+        std::unique_ptr<JPH::JobSystem> m_JobSystem;
         std::unique_ptr<JPH::PhysicsSystem> m_PhysicsSystem;
         
         // Layer interfaces
@@ -101,6 +109,7 @@ namespace Systems {
         // Settings
         glm::vec3 m_Gravity = {0.0f, -9.81f, 0.0f};
         int m_CollisionSteps = 1;
+        uint32_t m_ThreadCount = 0;
         
         bool m_Initialized = false;
     };
@@ -2,10 +2,13 @@
 #include <SDL3/SDL.h>
 #include <glm/gtc/matrix_transform.hpp>
 #include <flecs.h>
-#include <iostream>
 #include <cmath>
+#include <algorithm>
 #include "../Components/Components.h"
 #include "../Core/Log.h"
+#include "../Core/JobSystem.h"
+#include "../Core/FrameAllocator.h"
+#include "../Core/Profiler.h"
 #include "../Resources/Mesh.h"
 #include "../Resources/Texture.h"
 #include "../Resources/Shader.h"
@@ -14,64 +17,112 @@
 
 namespace Systems {
 
+    namespace {
+        // Blend two affine transforms: translation and scale linearly, rotation along the shortest arc
+        glm::mat4 InterpolateMatrix(const glm::mat4& previous, const glm::mat4& current, float alpha) {
+            if (previous == current) return current;
+
+            glm::vec3 previousScale(glm::length(glm::vec3(previous[0])), glm::length(glm::vec3(previous[1])), glm::length(glm::vec3(previous[2])));
+            glm::vec3 currentScale(glm::length(glm::vec3(current[0])), glm::length(glm::vec3(current[1])), glm::length(glm::vec3(current[2])));
+            if (glm::min(glm::min(previousScale.x, previousScale.y), previousScale.z) < 1e-6f ||
+                glm::min(glm::min(currentScale.x, currentScale.y), currentScale.z) < 1e-6f) {
+                return current;  // Degenerate, no rotation to recover
+            }
+
+            glm::quat previousRotation = glm::quat_cast(glm::mat3(glm::vec3(previous[0]) / previousScale.x,
+                                                                  glm::vec3(previous[1]) / previousScale.y,
+                                                                  glm::vec3(previous[2]) / previousScale.z));
+            glm::quat currentRotation = glm::quat_cast(glm::mat3(glm::vec3(current[0]) / currentScale.x,
+                                                                 glm::vec3(current[1]) / currentScale.y,
+                                                                 glm::vec3(current[2]) / currentScale.z));
+
+            glm::vec3 scale = glm::mix(previousScale, currentScale, alpha);
+            glm::mat4 result = glm::mat4_cast(glm::slerp(previousRotation, currentRotation, alpha));
+            result[0] *= scale.x;
+            result[1] *= scale.y;
+            result[2] *= scale.z;
+            result[3] = glm::vec4(glm::mix(glm::vec3(previous[3]), glm::vec3(current[3]), alpha), 1.0f);
+            return result;
+        }
+
+        glm::mat4 InterpolateWorld(const WorldTransform& current, const PreviousWorldTransform* previous, float alpha) {
+            if (!previous || !previous->valid) return current.matrix;
+            return InterpolateMatrix(previous->matrix, current.matrix, alpha);
+        }
+
+        // Slots reserved for a static batch: room to grow by half before every batch is laid out again
+        uint32_t BatchCapacity(uint32_t count) {
+            return std::max<uint32_t>(16, count + count / 2);
+        }
+    }
+
     RenderSystem::RenderSystem(Core::GameContext& context, Platform::RenderDevice& renderDevice, Resources::ResourceManager& resourceManager)
         : m_Context(context), m_RenderDevice(renderDevice), m_ResourceManager(resourceManager) {}
 
     RenderSystem::~RenderSystem() {
         if (m_Pipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_Pipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_Pipeline);
         }
         if (m_MeshPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_MeshPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_MeshPipeline);
         }
         if (m_InstancedMeshPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_InstancedMeshPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_InstancedMeshPipeline);
         }
         if (m_ForwardPlusPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_ForwardPlusPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_ForwardPlusPipeline);
         }
         if (m_LinePipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_LinePipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_LinePipeline);
         }
         if (m_ToneMappingPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_ToneMappingPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_ToneMappingPipeline);
         }
         if (m_BloomBrightPassPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_BloomBrightPassPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_BloomBrightPassPipeline);
         }
         if (m_BloomBlurPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_BloomBlurPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_BloomBlurPipeline);
         }
         if (m_BloomCompositePipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_BloomCompositePipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_BloomCompositePipeline);
         }
         if (m_SSGIPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_SSGIPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_SSGIPipeline);
         }
         if (m_SSGITemporalPipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_SSGITemporalPipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_SSGITemporalPipeline);
         }
         if (m_SSGIDenoisePipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_SSGIDenoisePipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_SSGIDenoisePipeline);
         }
         if (m_SSGICompositePipeline) {
-            SDL_ReleaseGPUGraphicsPipeline(m_RenderDevice.GetDevice(), m_SSGICompositePipeline);
+            m_RenderDevice.ReleaseGraphicsPipeline(m_SSGICompositePipeline);
         }
         if (m_Sampler) {
-            SDL_ReleaseGPUSampler(m_RenderDevice.GetDevice(), m_Sampler);
+            m_RenderDevice.ReleaseSampler(m_Sampler);
         }
         if (m_LinearSampler) {
-            SDL_ReleaseGPUSampler(m_RenderDevice.GetDevice(), m_LinearSampler);
+            m_RenderDevice.ReleaseSampler(m_LinearSampler);
         }
         if (m_DefaultSkinBuffer) {
-            SDL_ReleaseGPUBuffer(m_RenderDevice.GetDevice(), m_DefaultSkinBuffer);
+            m_RenderDevice.ReleaseBuffer(m_DefaultSkinBuffer);
         }
         if (m_InstanceBuffer) {
-            SDL_ReleaseGPUBuffer(m_RenderDevice.GetDevice(), m_InstanceBuffer);
+            m_RenderDevice.ReleaseBuffer(m_InstanceBuffer);
         }
+        if (m_ViewInstanceBuffer) {
+            m_RenderDevice.ReleaseBuffer(m_ViewInstanceBuffer);
+        }
+        if (m_LineBuffer) {
+            m_RenderDevice.ReleaseBuffer(m_LineBuffer);
+        }
+        for (auto b : m_BuffersToDelete) m_RenderDevice.ReleaseBuffer(b);
     }
 
     void RenderSystem::Init() {
+        m_SkinBlock.assign(RenderSnapshot::MaxSkinJoints, glm::mat4(1.0f));
+
         CreatePipeline();
         CreateMeshPipeline();
         CreateInstancedMeshPipeline();
@@ -94,7 +145,7 @@ namespace Systems {
         samplerInfo.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
         samplerInfo.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
         
-        m_Sampler = SDL_CreateGPUSampler(m_RenderDevice.GetDevice(), &samplerInfo);
+        m_Sampler = m_RenderDevice.CreateSampler(&samplerInfo);
         
         // Linear sampler (for HDR texture sampling)
         SDL_GPUSamplerCreateInfo linearSamplerInfo = {};
@@ -105,12 +156,11 @@ namespace Systems {
         linearSamplerInfo.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
         linearSamplerInfo.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
         
-        m_LinearSampler = SDL_CreateGPUSampler(m_RenderDevice.GetDevice(), &linearSamplerInfo);
+        m_LinearSampler = m_RenderDevice.CreateSampler(&linearSamplerInfo);
     }
 
     void RenderSystem::CreatePipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
         SDL_GPUShaderFormat format;
@@ -153,7 +203,7 @@ namespace Systems {
         if (m_RenderDevice.IsHDREnabled()) {
             colorTargetDesc.format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;  // HDR format
         } else {
-            colorTargetDesc.format = SDL_GetGPUSwapchainTextureFormat(device, m_RenderDevice.GetWindow()->GetNativeWindow());
+            colorTargetDesc.format = m_RenderDevice.GetSwapchainTextureFormat();
         }
         colorTargetDesc.blend_state.enable_blend = true;
         colorTargetDesc.blend_state.src_color_blendfactor = SDL_GPU_BLENDFACTOR_SRC_ALPHA;
@@ -169,7 +219,7 @@ namespace Systems {
         // Depth Stencil
         pipelineInfo.target_info.has_depth_stencil_target = false; // Basic pipeline is 2D/Sprite
 
-        m_Pipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_Pipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_Pipeline) {
             LOG_CORE_ERROR("Failed to create graphics pipeline!");
         } else {
@@ -178,8 +228,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateMeshPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
 
@@ -253,7 +302,7 @@ namespace Systems {
         if (m_RenderDevice.IsHDREnabled()) {
             colorTargetDesc.format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;  // HDR format
         } else {
-            colorTargetDesc.format = SDL_GetGPUSwapchainTextureFormat(device, m_RenderDevice.GetWindow()->GetNativeWindow());
+            colorTargetDesc.format = m_RenderDevice.GetSwapchainTextureFormat();
         }
         colorTargetDesc.blend_state.enable_blend = false; // Opaque for now
 
@@ -270,7 +319,7 @@ namespace Systems {
         pipelineInfo.target_info.has_depth_stencil_target = true;
         pipelineInfo.target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
 
-        m_MeshPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_MeshPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_MeshPipeline) {
             LOG_CORE_ERROR("Failed to create mesh pipeline!");
         } else {
@@ -279,8 +328,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateInstancedMeshPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
 
@@ -392,7 +440,7 @@ namespace Systems {
         if (m_RenderDevice.IsHDREnabled()) {
             colorTargetDesc.format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;  // HDR format
         } else {
-            colorTargetDesc.format = SDL_GetGPUSwapchainTextureFormat(device, m_RenderDevice.GetWindow()->GetNativeWindow());
+            colorTargetDesc.format = m_RenderDevice.GetSwapchainTextureFormat();
         }
         colorTargetDesc.blend_state.enable_blend = false; // Opaque
 
@@ -409,7 +457,7 @@ namespace Systems {
         pipelineInfo.target_info.has_depth_stencil_target = true;
         pipelineInfo.target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
 
-        m_InstancedMeshPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_InstancedMeshPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_InstancedMeshPipeline) {
             LOG_CORE_WARN("Failed to create instanced mesh pipeline - batching will be disabled");
         } else {
@@ -418,8 +466,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateLinePipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
 
@@ -481,7 +528,7 @@ namespace Systems {
         if (m_RenderDevice.IsHDREnabled()) {
             colorTargetDesc.format = SDL_GPU_TEXTUREFORMAT_R16G16B16A16_FLOAT;  // HDR format
         } else {
-            colorTargetDesc.format = SDL_GetGPUSwapchainTextureFormat(device, m_RenderDevice.GetWindow()->GetNativeWindow());
+            colorTargetDesc.format = m_RenderDevice.GetSwapchainTextureFormat();
         }
         colorTargetDesc.blend_state.enable_blend = false;
 
@@ -500,7 +547,7 @@ namespace Systems {
         pipelineInfo.target_info.has_depth_stencil_target = true;
         pipelineInfo.target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
 
-        m_LinePipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_LinePipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_LinePipeline) {
             LOG_CORE_ERROR("Failed to create line pipeline!");
         } else {
@@ -509,8 +556,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateToneMappingPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
         
@@ -551,7 +597,7 @@ namespace Systems {
         
         // Color Target - outputs to swapchain format
         SDL_GPUColorTargetDescription colorTargetDesc = {};
-        colorTargetDesc.format = SDL_GetGPUSwapchainTextureFormat(device, m_RenderDevice.GetWindow()->GetNativeWindow());
+        colorTargetDesc.format = m_RenderDevice.GetSwapchainTextureFormat();
         colorTargetDesc.blend_state.enable_blend = false;
         
         pipelineInfo.target_info.num_color_targets = 1;
@@ -560,7 +606,7 @@ namespace Systems {
         // No depth testing for fullscreen pass
         pipelineInfo.target_info.has_depth_stencil_target = false;
         
-        m_ToneMappingPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_ToneMappingPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_ToneMappingPipeline) {
             LOG_CORE_ERROR("Failed to create tone mapping pipeline!");
         } else {
@@ -569,8 +615,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateBloomPipelines() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         bool isD3D12 = std::string(driver) == "direct3d12";
         
         // ========== Bright Pass Pipeline ==========
@@ -600,7 +645,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_BloomBrightPassPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_BloomBrightPassPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_BloomBrightPassPipeline) {
                     LOG_CORE_INFO("Bloom Bright Pass Pipeline Created Successfully!");
                 }
@@ -634,7 +679,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_BloomBlurPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_BloomBlurPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_BloomBlurPipeline) {
                     LOG_CORE_INFO("Bloom Blur Pipeline Created Successfully!");
                 }
@@ -670,7 +715,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_BloomCompositePipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_BloomCompositePipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_BloomCompositePipeline) {
                     LOG_CORE_INFO("Bloom Composite Pipeline Created Successfully!");
                 }
@@ -679,8 +724,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateSSGIPipelines() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         bool isD3D12 = std::string(driver) == "direct3d12";
         
         // ========== SSGI Main Pipeline (Ray March) ==========
@@ -712,7 +756,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_SSGIPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_SSGIPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_SSGIPipeline) {
                     LOG_CORE_INFO("SSGI Pipeline Created Successfully!");
                 }
@@ -747,7 +791,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_SSGITemporalPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_SSGITemporalPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_SSGITemporalPipeline) {
                     LOG_CORE_INFO("SSGI Temporal Pipeline Created Successfully!");
                 }
@@ -782,7 +826,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_SSGIDenoisePipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_SSGIDenoisePipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_SSGIDenoisePipeline) {
                     LOG_CORE_INFO("SSGI Denoise Pipeline Created Successfully!");
                 }
@@ -824,7 +868,7 @@ namespace Systems {
                 pipelineInfo.target_info.color_target_descriptions = &colorTargetDesc;
                 pipelineInfo.target_info.has_depth_stencil_target = false;
                 
-                m_SSGICompositePipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+                m_SSGICompositePipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
                 if (m_SSGICompositePipeline) {
                     LOG_CORE_INFO("SSGI Composite Pipeline Created Successfully!");
                 }
@@ -833,8 +877,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateDepthOnlyPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
         
@@ -960,7 +1003,7 @@ namespace Systems {
         pipelineInfo.depth_stencil_state.enable_depth_write = true;
         pipelineInfo.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
         
-        m_DepthOnlyPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_DepthOnlyPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_DepthOnlyPipeline) {
             LOG_CORE_WARN("Failed to create depth-only pipeline - Forward+ will be unavailable");
         } else {
@@ -969,8 +1012,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateLightCullingPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string compPath;
         
@@ -982,7 +1024,7 @@ namespace Systems {
         
         // For compute shaders, we just load the bytecode directly (not via LoadShader)
         std::vector<char> bytecode = Resources::ResourceManager::ReadFile(compPath);
-        if (bytecode.empty()) {
+        if (bytecode.empty() && !m_RenderDevice.IsNull()) {  // The null backend never looks at the code
             LOG_CORE_WARN("Failed to load light culling compute shader - Forward+ will be unavailable");
             return;
         }
@@ -1002,7 +1044,7 @@ namespace Systems {
         pipelineInfo.threadcount_y = 16;
         pipelineInfo.threadcount_z = 1;
         
-        m_LightCullingPipeline = SDL_CreateGPUComputePipeline(device, &pipelineInfo);
+        m_LightCullingPipeline = m_RenderDevice.CreateComputePipeline(&pipelineInfo);
         if (!m_LightCullingPipeline) {
             LOG_CORE_WARN("Failed to create light culling compute pipeline: {} - Forward+ will be unavailable", SDL_GetError());
         } else {
@@ -1017,13 +1059,12 @@ namespace Systems {
             samplerInfo.address_mode_v = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
             samplerInfo.address_mode_w = SDL_GPU_SAMPLERADDRESSMODE_CLAMP_TO_EDGE;
             
-            m_DepthSampler = SDL_CreateGPUSampler(device, &samplerInfo);
+            m_DepthSampler = m_RenderDevice.CreateSampler(&samplerInfo);
         }
     }
 
     void RenderSystem::CreateShadowMapPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
         
@@ -1152,7 +1193,7 @@ namespace Systems {
         pipelineInfo.depth_stencil_state.enable_depth_write = true;
         pipelineInfo.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
         
-        m_ShadowMapPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_ShadowMapPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_ShadowMapPipeline) {
             LOG_CORE_WARN("Failed to create shadow map pipeline: {} - shadows will be unavailable", SDL_GetError());
         } else {
@@ -1161,8 +1202,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateShadowMapSkinnedPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         LOG_CORE_INFO("Creating Skinned Shadow Map Pipeline...");
         
@@ -1263,7 +1303,7 @@ namespace Systems {
         pipelineInfo.depth_stencil_state.enable_depth_write = true;
         pipelineInfo.depth_stencil_state.compare_op = SDL_GPU_COMPAREOP_LESS;
         
-        m_ShadowMapSkinnedPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_ShadowMapSkinnedPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_ShadowMapSkinnedPipeline) {
             LOG_CORE_WARN("Failed to create skinned shadow map pipeline: {} - skinned mesh shadows unavailable", SDL_GetError());
         } else {
@@ -1272,8 +1312,7 @@ namespace Systems {
     }
 
     void RenderSystem::CreateForwardPlusPipeline() {
-        SDL_GPUDevice* device = m_RenderDevice.GetDevice();
-        const char* driver = SDL_GetGPUDeviceDriver(device);
+        const char* driver = m_RenderDevice.GetDriverName();
         
         std::string vertPath, fragPath;
 
@@ -1379,7 +1418,7 @@ namespace Systems {
         pipelineInfo.target_info.has_depth_stencil_target = true;
         pipelineInfo.target_info.depth_stencil_format = SDL_GPU_TEXTUREFORMAT_D24_UNORM_S8_UINT;
 
-        m_ForwardPlusPipeline = SDL_CreateGPUGraphicsPipeline(device, &pipelineInfo);
+        m_ForwardPlusPipeline = m_RenderDevice.CreateGraphicsPipeline(&pipelineInfo);
         if (!m_ForwardPlusPipeline) {
             LOG_CORE_WARN("Failed to create Forward+ pipeline: {}", SDL_GetError());
         } else {
@@ -1387,13 +1426,14 @@ namespace Systems {
         }
     }
 
-    void RenderSystem::RenderDepthPrePass(const glm::mat4& view, const glm::mat4& proj) {
+    void RenderSystem::RenderDepthPrePass(const RenderSnapshot& snapshot, const glm::mat4& view, const glm::mat4& proj) {
+        PROFILE_SCOPE("Render::DepthPrePass");
         if (!m_DepthOnlyPipeline || !m_RenderDevice.IsForwardPlusEnabled()) return;
         
         if (!m_RenderDevice.BeginDepthPrePass()) return;
         
         SDL_GPURenderPass* pass = m_RenderDevice.GetRenderPass();
-        SDL_BindGPUGraphicsPipeline(pass, m_DepthOnlyPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_DepthOnlyPipeline);
         
         // Set viewport
         SDL_GPUViewport viewport = {};
@@ -1403,7 +1443,7 @@ namespace Systems {
         viewport.h = static_cast<float>(m_RenderDevice.GetRenderHeight());
         viewport.min_depth = 0.0f;
         viewport.max_depth = 1.0f;
-        SDL_SetGPUViewport(pass, &viewport);
+        m_RenderDevice.SetViewport(pass, &viewport);
         
         // Push ViewProjection uniform
         struct ViewProj {
@@ -1412,100 +1452,43 @@ namespace Systems {
         } vp;
         vp.view = view;
         vp.proj = proj;
-        SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &vp, sizeof(vp));
+        m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &vp, sizeof(vp));
         
-        // Render all batches (depth only)
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (batch.instances.empty()) continue;
+        // Render the batches the camera sees (depth only)
+        for (const MeshBatch& batch : m_CameraView.batches) {
             
             auto mesh = batch.mesh;
-            if (!mesh) continue;
+            if (!mesh || batch.instanceCount == 0) continue;
             
             SDL_GPUBufferBinding vertexBuffers[2] = {};
             vertexBuffers[0].buffer = mesh->GetVertexBuffer();
             vertexBuffers[0].offset = 0;
-            vertexBuffers[1].buffer = m_InstanceBuffer;
+            vertexBuffers[1].buffer = m_ViewInstanceBuffer;
             vertexBuffers[1].offset = batch.instanceOffset * sizeof(Systems::MeshInstance);
             
-            SDL_BindGPUVertexBuffers(pass, 0, vertexBuffers, 2);
+            m_RenderDevice.BindVertexBuffers(pass, 0, vertexBuffers, 2);
             
             SDL_GPUBufferBinding indexBufferBinding = {};
             indexBufferBinding.buffer = mesh->GetIndexBuffer();
             indexBufferBinding.offset = 0;
-            SDL_BindGPUIndexBuffer(pass, &indexBufferBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            m_RenderDevice.BindIndexBuffer(pass, &indexBufferBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
             
-            SDL_DrawGPUIndexedPrimitives(pass, mesh->GetIndexCount(), static_cast<uint32_t>(batch.instances.size()), 0, 0, 0);
+            m_RenderDevice.DrawIndexedPrimitives(pass, mesh->GetIndexCount(), batch.instanceCount, 0, 0, 0);
         }
         
         m_RenderDevice.EndRenderPass();
     }
 
-    void RenderSystem::RenderShadowPass(const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData) {
+    void RenderSystem::RenderShadowPass(const RenderSnapshot& snapshot) {
+        PROFILE_SCOPE("Render::Shadows");
         if (!m_ShadowMapPipeline || !m_RenderDevice.IsShadowsEnabled()) return;
         if (!m_RenderDevice.IsFrameValid()) return;
         
-        // Calculate light space matrix from directional light
-        glm::vec3 lightDir = glm::normalize(glm::vec3(-0.5f, -1.0f, -0.3f));  // Default
-        
-        // Query for directional light to get actual direction
-        m_Context.World->query<const DirectionalLight>()
-            .each([&](flecs::entity e, const DirectionalLight& light) {
-                lightDir = glm::normalize(light.direction);
-            });
-        
-        // Get camera position and direction for shadow frustum placement
-        glm::vec3 cameraPos = glm::vec3(0.0f);
-        glm::vec3 cameraLookAt = glm::vec3(0.0f);
-        bool foundCamera = false;
-        
-        // Try to get camera with follow component (has currentLookAt which is better)
-        m_Context.World->query<LocalTransform, const CameraComponent, const CameraFollowComponent>()
-            .each([&](flecs::entity e, LocalTransform& t, const CameraComponent& cam, const CameraFollowComponent& follow) {
-                if (cam.isPrimary) {
-                    cameraPos = t.position;
-                    cameraLookAt = follow.currentLookAt;
-                    foundCamera = true;
-                }
-            });
-        
-        // Fallback: use just camera transform
-        if (!foundCamera) {
-            m_Context.World->query<LocalTransform, const CameraComponent>()
-                .each([&](flecs::entity e, LocalTransform& t, const CameraComponent& cam) {
-                    if (cam.isPrimary) {
-                        cameraPos = t.position;
-                        // Default look direction
-                        float yaw = glm::radians(t.rotation.y);
-                        cameraLookAt = cameraPos + glm::vec3(sin(yaw), 0.0f, -cos(yaw)) * 10.0f;
-                        foundCamera = true;
-                    }
-                });
-        }
-        
-        // Shadow frustum parameters - cover the whole play area
-        float shadowDistance = 100.0f;
-        float shadowNear = 1.0f;        
-        float shadowFar = 200.0f;       
-        float orthoSize = 80.0f;        // Large area
-        
-        // Center shadow frustum at where camera is looking (on ground level)
-        glm::vec3 shadowCenter = glm::vec3(cameraLookAt.x, 0.0f, cameraLookAt.z);
-        
-        // Light position: go OPPOSITE to light direction (light shines from lightPos toward shadowCenter)
-        glm::vec3 lightPos = shadowCenter - lightDir * shadowDistance;
-        glm::mat4 lightView = glm::lookAt(lightPos, shadowCenter, glm::vec3(0.0f, 1.0f, 0.0f));
-        
-        // Orthographic projection - use ZO (zero-to-one) for Vulkan's depth range
-        glm::mat4 lightProj = glm::orthoZO(-orthoSize, orthoSize, -orthoSize, orthoSize, shadowNear, shadowFar);
-        
-        // Store for use in main pass
-        m_LightSpaceMatrix = lightProj * lightView;
-        
         // Begin shadow render pass
         if (!m_RenderDevice.BeginShadowPass()) return;
         
         SDL_GPURenderPass* pass = m_RenderDevice.GetRenderPass();
-        SDL_BindGPUGraphicsPipeline(pass, m_ShadowMapPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_ShadowMapPipeline);
         
         // Set viewport to shadow map size
         uint32_t shadowSize = m_RenderDevice.GetShadowMapSize();
@@ -1516,95 +1499,99 @@ namespace Systems {
         viewport.h = static_cast<float>(shadowSize);
         viewport.min_depth = 0.0f;
         viewport.max_depth = 1.0f;
-        SDL_SetGPUViewport(pass, &viewport);
+        m_RenderDevice.SetViewport(pass, &viewport);
         
         // Push light space matrix uniform
-        SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &m_LightSpaceMatrix, sizeof(m_LightSpaceMatrix));
+        m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &m_LightSpaceMatrix, sizeof(m_LightSpaceMatrix));
         
-        // Render all batches to shadow map
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (batch.instances.empty()) continue;
+        // Render the batches inside the light's frustum to the shadow map
+        for (const MeshBatch& batch : m_ShadowView.batches) {
             
             auto mesh = batch.mesh;
-            if (!mesh) continue;
+            if (!mesh || batch.instanceCount == 0) continue;
             
             SDL_GPUBufferBinding vertexBuffers[2] = {};
             vertexBuffers[0].buffer = mesh->GetVertexBuffer();
             vertexBuffers[0].offset = 0;
-            vertexBuffers[1].buffer = m_InstanceBuffer;
+            vertexBuffers[1].buffer = m_ViewInstanceBuffer;
             vertexBuffers[1].offset = batch.instanceOffset * sizeof(Systems::MeshInstance);
             
-            SDL_BindGPUVertexBuffers(pass, 0, vertexBuffers, 2);
+            m_RenderDevice.BindVertexBuffers(pass, 0, vertexBuffers, 2);
             
             SDL_GPUBufferBinding indexBufferBinding = {};
             indexBufferBinding.buffer = mesh->GetIndexBuffer();
             indexBufferBinding.offset = 0;
-            SDL_BindGPUIndexBuffer(pass, &indexBufferBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            m_RenderDevice.BindIndexBuffer(pass, &indexBufferBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
             
-            SDL_DrawGPUIndexedPrimitives(pass, mesh->GetIndexCount(), static_cast<uint32_t>(batch.instances.size()), 0, 0, 0);
+            m_RenderDevice.DrawIndexedPrimitives(pass, mesh->GetIndexCount(), batch.instanceCount, 0, 0, 0);
             m_Stats.drawCalls++;
         }
         
         // Render skinned meshes to shadow map
-        RenderSkinnedMeshesToShadowMap(pass, skinData);
+        RenderSkinnedMeshesToShadowMap(snapshot, pass);
         
         m_RenderDevice.EndShadowPass();
     }
     
-    void RenderSystem::RenderSkinnedMeshesToShadowMap(SDL_GPURenderPass* pass, const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData) {
+    const glm::mat4* RenderSystem::FillSkinBlock(const RenderSnapshot& snapshot, const SkinnedInstance& instance) {
+        // Palettes are packed to the joints each mesh uses, but the shaders declare the whole block.
+        // Pushing copies it straight away, so one block serves every draw; past the palette it stays identity.
+        uint32_t count = instance.paletteOffset == SkinnedInstance::NoPalette ? 0 : instance.jointCount;
+        if (count > 0) {
+            std::copy_n(snapshot.skinPalettes.begin() + instance.paletteOffset, count, m_SkinBlock.begin());
+        }
+        if (m_SkinBlockUsed > count) {
+            std::fill(m_SkinBlock.begin() + count, m_SkinBlock.begin() + m_SkinBlockUsed, glm::mat4(1.0f));
+        }
+        m_SkinBlockUsed = count;
+        return m_SkinBlock.data();
+    }
+
+    void RenderSystem::RenderSkinnedMeshesToShadowMap(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass) {
         if (!m_ShadowMapSkinnedPipeline) return;
         
-        SDL_BindGPUGraphicsPipeline(pass, m_ShadowMapSkinnedPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_ShadowMapSkinnedPipeline);
         
-        m_Context.World->query<WorldTransform, MeshComponent, AnimatorComponent>()
-            .each([&](flecs::entity e, WorldTransform& t, MeshComponent& meshComp, AnimatorComponent& anim) {
-                if (!meshComp.mesh || !anim.skeleton) return;
-                
-                // Apply render offset to model matrix
-                glm::mat4 model = t.matrix;
-                if (meshComp.renderOffset != glm::vec3(0.0f)) {
-                    model = glm::translate(model, meshComp.renderOffset);
-                }
-                
-                // Push light space matrix (binding 0)
-                SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &m_LightSpaceMatrix, sizeof(m_LightSpaceMatrix));
-                
-                // Push model matrix (binding 1)
-                SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 1, &model, sizeof(model));
-                
-                // Push skin matrices (binding 2)
-                std::vector<glm::mat4> skinMatrices(256, glm::mat4(1.0f));
-                auto it = skinData.find(e.id());
-                if (it != skinData.end()) {
-                    skinMatrices = it->second;
-                }
-                SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 2, skinMatrices.data(), 256 * sizeof(glm::mat4));
-                
-                // Bind vertex buffer
-                SDL_GPUBufferBinding vertexBinding = {};
-                vertexBinding.buffer = meshComp.mesh->GetVertexBuffer();
-                vertexBinding.offset = 0;
-                SDL_BindGPUVertexBuffers(pass, 0, &vertexBinding, 1);
-                
-                // Bind index buffer
-                SDL_GPUBufferBinding indexBinding = {};
-                indexBinding.buffer = meshComp.mesh->GetIndexBuffer();
-                indexBinding.offset = 0;
-                SDL_BindGPUIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
-                
-                // Draw
-                SDL_DrawGPUIndexedPrimitives(pass, meshComp.mesh->GetIndexCount(), 1, 0, 0, 0);
-                m_Stats.drawCalls++;
-            });
+        for (size_t i = 0; i < snapshot.skinned.size(); ++i) {
+            if (!m_ShadowView.skinnedVisible[i]) continue;
+            const SkinnedInstance& instance = snapshot.skinned[i];
+
+            // Push light space matrix (binding 0)
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &m_LightSpaceMatrix, sizeof(m_LightSpaceMatrix));
+            
+            // Push model matrix (binding 1)
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 1, &instance.model, sizeof(instance.model));
+            
+            // Push skin matrices (binding 2)
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 2, FillSkinBlock(snapshot, instance), RenderSnapshot::MaxSkinJoints * sizeof(glm::mat4));
+            
+            // Bind vertex buffer
+            SDL_GPUBufferBinding vertexBinding = {};
+            vertexBinding.buffer = instance.mesh->GetVertexBuffer();
+            vertexBinding.offset = 0;
+            m_RenderDevice.BindVertexBuffers(pass, 0, &vertexBinding, 1);
+            
+            // Bind index buffer
+            SDL_GPUBufferBinding indexBinding = {};
+            indexBinding.buffer = instance.mesh->GetIndexBuffer();
+            indexBinding.offset = 0;
+            m_RenderDevice.BindIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            
+            // Draw
+            m_RenderDevice.DrawIndexedPrimitives(pass, instance.mesh->GetIndexCount(), 1, 0, 0, 0);
+            m_Stats.drawCalls++;
+        }
     }
 
     void RenderSystem::DispatchLightCulling(const glm::mat4& view, const glm::mat4& proj) {
+        PROFILE_SCOPE("Render::LightCulling");
         if (!m_LightCullingPipeline || !m_RenderDevice.IsForwardPlusEnabled()) return;
         
         m_RenderDevice.DispatchLightCulling(m_LightCullingPipeline, view, proj);
     }
 
-    void RenderSystem::UpdateLightBufferForForwardPlus() {
+    void RenderSystem::UpdateLightBufferForForwardPlus(const RenderSnapshot& snapshot) {
+        PROFILE_SCOPE("Render::LightBuffer");
         // Structure matching the shader's LightBuffer layout
         struct GPUPointLight {
             glm::vec4 positionRadius;  // xyz = position, w = radius
@@ -1628,29 +1615,21 @@ namespace Systems {
         
         constexpr int MAX_POINT_LIGHTS = 1024;
         
-        // Collect all point lights with entity IDs for stable sorting
-        std::vector<GPUPointLight> lights;
+        // Point lights arrive sorted by entity ID, so the order is stable between frames
+        Core::FrameVector<GPUPointLight> lights;
         lights.reserve(MAX_POINT_LIGHTS);
         
-        m_Context.World->query<const WorldTransform, const PointLight>()
-            .each([&](flecs::entity e, const WorldTransform& t, const PointLight& light) {
-                if (lights.size() < MAX_POINT_LIGHTS) {
-                    glm::vec3 pos = glm::vec3(t.matrix[3]);
-                    GPUPointLight gpuLight;
-                    gpuLight.positionRadius = glm::vec4(pos, light.radius);
-                    gpuLight.colorIntensity = glm::vec4(light.color, light.intensity);
-                    gpuLight.entityId = e.id();
-                    lights.push_back(gpuLight);
-                }
-            });
-        
-        // Sort by entity ID for consistent ordering between frames
-        std::sort(lights.begin(), lights.end(), [](const GPUPointLight& a, const GPUPointLight& b) {
-            return a.entityId < b.entityId;
-        });
+        for (const PointLightInstance& light : snapshot.pointLights) {
+            if (lights.size() >= MAX_POINT_LIGHTS) break;
+            GPUPointLight gpuLight;
+            gpuLight.positionRadius = glm::vec4(light.position, light.radius);
+            gpuLight.colorIntensity = glm::vec4(light.color, light.intensity);
+            gpuLight.entityId = light.entityId;
+            lights.push_back(gpuLight);
+        }
         
         // Build buffer data: header + packed lights (without entityId)
-        std::vector<uint8_t> bufferData;
+        Core::FrameVector<uint8_t> bufferData;
         bufferData.resize(sizeof(LightBufferHeader) + lights.size() * sizeof(GPUPointLightPacked));
         
         LightBufferHeader header;
@@ -1688,287 +1667,652 @@ namespace Systems {
         m_RenderDevice.UpdateLightBuffer(bufferData.data(), static_cast<uint32_t>(lights.size()));
     }
 
-    void RenderSystem::BeginFrame(bool drawSkeleton) {
-        // Cleanup resources from previous frames
-        for (auto b : m_BuffersToDelete) SDL_ReleaseGPUBuffer(m_RenderDevice.GetDevice(), b);
-        m_BuffersToDelete.clear();
-        for (auto b : m_TransferBuffersToDelete) SDL_ReleaseGPUTransferBuffer(m_RenderDevice.GetDevice(), b);
-        m_TransferBuffersToDelete.clear();
-
-        // Generate Debug Lines BEFORE BeginFrame (which starts the RenderPass)
-        // This allows us to upload data using CopyPass if needed, or just prepare data.
-        // Actually, we need a command buffer to do CopyPass.
-        // RenderDevice::BeginFrame acquires the command buffer.
-        // So we should probably do this:
-        // 1. Acquire Command Buffer (RenderDevice::BeginFrame)
-        // 2. Do Uploads (CopyPass)
-        // 3. Start Render Pass (RenderDevice::BeginRenderPass)
-        
-        // Currently RenderDevice::BeginFrame does NOT start the render pass.
-        // It acquires the command buffer and swapchain texture.
-        // RenderDevice::BeginRenderPass starts the pass.
-        
-        m_RenderDevice.BeginFrame();
-        
-        // Now we have a command buffer but no render pass yet.
-        // We can generate lines and upload them here!
-        
-        m_LineVertices.clear();
-        
-        // Debug Draw Skeletons (conditional)
-        if (drawSkeleton) {
-            m_Context.World->query<WorldTransform, AnimatorComponent, MeshComponent>()
-                .each([&](flecs::entity e, WorldTransform& t, AnimatorComponent& anim, MeshComponent& meshComp) {
-                    if (anim.skeleton && !anim.models.empty()) {
-                        const auto& parents = anim.skeleton->skeleton.joint_parents();
-                        int numJoints = anim.skeleton->skeleton.num_joints();
-                        
-                        // Apply render offset for skeleton debug drawing (same as mesh)
-                        glm::mat4 offsetMatrix = t.matrix;
-                        if (meshComp.renderOffset != glm::vec3(0.0f)) {
-                            offsetMatrix = glm::translate(offsetMatrix, meshComp.renderOffset);
-                        }
-                        
-                        for (int i = 0; i < numJoints; ++i) {
-                            int parent = parents[i];
-                            if (parent != ozz::animation::Skeleton::kNoParent) {
-                                glm::mat4 childModel;
-                                memcpy(&childModel, &anim.models[i], sizeof(glm::mat4));
-                                
-                                glm::mat4 parentModel;
-                                memcpy(&parentModel, &anim.models[parent], sizeof(glm::mat4));
-                                
-                                glm::vec3 p1 = glm::vec3(offsetMatrix * childModel * glm::vec4(0,0,0,1));
-                                glm::vec3 p2 = glm::vec3(offsetMatrix * parentModel * glm::vec4(0,0,0,1));
-                                
-                                DrawLine(p1, p2, {1.0f, 1.0f, 0.0f});
+    void RenderSystem::Extract(RenderSnapshot& snapshot, double alpha, bool drawSkeleton, bool drawColliders) {
+        snapshot.Clear();
+        snapshot.extractedAt = SDL_GetTicksNS();
+        snapshot.alpha = alpha;
+        const float blend = static_cast<float>(alpha);
+
+        // Primary camera (first one wins), between its last two ticks
+        m_Context.World->query<const LocalTransform, const CameraComponent, const PreviousCameraTransform*>()
+            .each([&](flecs::entity e, const LocalTransform& t, const CameraComponent& cam, const PreviousCameraTransform* previous) {
+                if (!cam.isPrimary || snapshot.hasCamera) return;
+
+                glm::vec3 position = t.position;
+                glm::quat rotation = t.rotation;
+                if (previous && previous->valid) {
+                    position = glm::mix(previous->position, t.position, blend);
+                    rotation = glm::slerp(previous->rotation, t.rotation, blend);
+                }
+
+                glm::mat4 camMatrix = glm::translate(glm::mat4(1.0f), position) * glm::mat4_cast(rotation);
+                snapshot.view = glm::inverse(camMatrix);
+                snapshot.cameraPosition = position;
+                snapshot.fov = cam.fov;
+                snapshot.nearPlane = cam.nearPlane;
+                snapshot.farPlane = cam.farPlane;
+                snapshot.hasCamera = true;
+
+                // A follow camera knows what it looks at; otherwise look 10 units ahead along the yaw
+                if (e.has<CameraFollowComponent>()) {
+                    snapshot.shadowFocus = e.get<CameraFollowComponent>().currentLookAt;
+                } else {
+                    glm::vec3 forward = rotation * glm::vec3(0.0f, 0.0f, -1.0f);
+                    float yaw = std::atan2(-forward.x, -forward.z);
+                    snapshot.shadowFocus = position + glm::vec3(sin(yaw), 0.0f, -cos(yaw)) * 10.0f;
+                }
+            });
+
+        if (!snapshot.hasCamera) {
+            snapshot.view = glm::lookAt(glm::vec3(0, 2, 5), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+        }
+
+        ExtractMeshes(snapshot, drawSkeleton);
+        ExtractLights(snapshot);
+
+        if (drawColliders) {
+            ExtractPhysicsDebug();
+        }
+
+        m_Context.World->query<const WorldTransform, const SpriteComponent, const PreviousWorldTransform*>()
+            .each([&](flecs::entity e, const WorldTransform& t, const SpriteComponent& s, const PreviousWorldTransform* previous) {
+                if (s.texture) {
+                    snapshot.sprites.push_back({ InterpolateWorld(t, previous, blend), s.texture });
+                }
+            });
+
+        // Lines drawn since the last snapshot, including any from game code during the tick
+        snapshot.lines.swap(m_LineVertices);
+    }
+
+    void RenderSystem::ExtractMeshes(RenderSnapshot& snapshot, bool drawSkeleton) {
+        PROFILE_SCOPE("Extract::Meshes");
+        m_PosedScratch.clear();
+        const uint64_t serial = ++m_ExtractSerial;
+        uint32_t seenSlots = 0;
+
+        // One pass over every mesh: static ones keep their slot and only rewrite it when the instance
+        // changed, skinned ones go straight into the snapshot and their palettes are computed afterwards
+        const float blend = static_cast<float>(snapshot.alpha);
+        m_Context.World->query<const WorldTransform, const MeshComponent, const PreviousWorldTransform*>()
+            .each([&](flecs::entity e, const WorldTransform& t, const MeshComponent& meshComp, const PreviousWorldTransform* previous) {
+                const AnimatorComponent* anim = e.try_get<AnimatorComponent>();
+                bool hasSkinning = anim && anim->skeleton;
+                if (!meshComp.mesh && !hasSkinning) return;
+
+                // Build model matrix with render offset
+                glm::mat4 model = InterpolateWorld(t, previous, blend);
+                if (meshComp.renderOffset != glm::vec3(0.0f)) {
+                    model = glm::translate(model, meshComp.renderOffset);
+                }
+
+                if (!hasSkinning) {
+                    MeshInstance instance = { model, glm::vec4(1.0f) };  // Default white, could use material color
+                    uint32_t entityIndex = static_cast<uint32_t>(e.id());
+                    if (entityIndex >= m_EntitySlots.size()) {
+                        m_EntitySlots.resize(entityIndex + 1);
+                    }
+                    EntitySlot& slot = m_EntitySlots[entityIndex];
+
+                    // The slot may belong to a dead entity that had the same index
+                    bool owned = slot.batch != EntitySlot::None && slot.index < m_StaticBatches[slot.batch].entities.size()
+                              && m_StaticBatches[slot.batch].entities[slot.index] == e.id();
+                    if (owned && m_StaticBatches[slot.batch].mesh != meshComp.mesh) {
+                        RemoveStaticSlot(slot.batch, slot.index);
+                        owned = false;
+                    }
+
+                    if (owned) {
+                        StaticBatch& batch = m_StaticBatches[slot.batch];
+                        batch.seen[slot.index] = serial;
+                        if (memcmp(&batch.instances[slot.index], &instance, sizeof(MeshInstance)) != 0) {
+                            batch.instances[slot.index] = instance;
+                            if (!batch.dirty[slot.index]) {
+                                batch.dirty[slot.index] = 1;
+                                batch.dirtyCount++;
                             }
                         }
+                    } else {
+                        auto [it, inserted] = m_BatchLookup.try_emplace(meshComp.mesh.get(), static_cast<uint32_t>(m_StaticBatches.size()));
+                        if (inserted) {
+                            m_StaticBatches.emplace_back().mesh = meshComp.mesh;
+                        }
+                        StaticBatch& batch = m_StaticBatches[it->second];
+                        slot = { it->second, static_cast<uint32_t>(batch.instances.size()) };
+                        batch.instances.push_back(instance);
+                        batch.entities.push_back(e.id());
+                        batch.seen.push_back(serial);
+                        batch.dirty.push_back(1);
+                        batch.dirtyCount++;
+                        m_OccupiedSlots++;
+                    }
+                    seenSlots++;
+                    snapshot.totalInstances++;
+                    return;
+                }
+
+                if (meshComp.mesh) {
+                    if (!anim->models.empty()) {
+                        m_PosedScratch.push_back({ anim, static_cast<uint32_t>(snapshot.skinned.size()) });
                     }
-                });
+                    snapshot.skinned.push_back({ meshComp.mesh, model });
+                    snapshot.totalInstances++;
+                }
+
+                // Debug Draw Skeletons (conditional)
+                if (drawSkeleton && !anim->models.empty()) {
+                    const auto& parents = anim->skeleton->skeleton.joint_parents();
+                    int numJoints = anim->skeleton->skeleton.num_joints();
+
+                    for (int i = 0; i < numJoints; ++i) {
+                        int parent = parents[i];
+                        if (parent != ozz::animation::Skeleton::kNoParent) {
+                            glm::mat4 childModel;
+                            memcpy(&childModel, &anim->models[i], sizeof(glm::mat4));
+
+                            glm::mat4 parentModel;
+                            memcpy(&parentModel, &anim->models[parent], sizeof(glm::mat4));
+
+                            glm::vec3 p1 = glm::vec3(model * childModel * glm::vec4(0,0,0,1));
+                            glm::vec3 p2 = glm::vec3(model * parentModel * glm::vec4(0,0,0,1));
+
+                            DrawLine(p1, p2, {1.0f, 1.0f, 0.0f});
+                        }
+                    }
+                }
+            });
+
+        // Entities that lost their mesh or were destroyed weren't visited; give their slots back.
+        // Backwards, so the instance swapped into a freed slot has already been checked.
+        if (seenSlots != m_OccupiedSlots) {
+            for (uint32_t b = 0; b < m_StaticBatches.size(); ++b) {
+                StaticBatch& batch = m_StaticBatches[b];
+                for (uint32_t i = static_cast<uint32_t>(batch.seen.size()); i-- > 0;) {
+                    if (batch.seen[i] != serial) {
+                        RemoveStaticSlot(b, i);
+                    }
+                }
+            }
         }
 
-        // Upload Lines if any
-        if (!m_LineVertices.empty()) {
-            SDL_GPUBufferCreateInfo bufferInfo = {};
-            bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
-            bufferInfo.size = m_LineVertices.size() * sizeof(LineVertex);
-            
-            SDL_GPUBuffer* lineBuffer = SDL_CreateGPUBuffer(m_RenderDevice.GetDevice(), &bufferInfo);
-            
-            SDL_GPUTransferBufferCreateInfo transferInfo = {};
-            transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferInfo.size = bufferInfo.size;
-            
-            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_RenderDevice.GetDevice(), &transferInfo);
-            
-            Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer, false);
-            if (map) {
-                memcpy(map, m_LineVertices.data(), bufferInfo.size);
-                SDL_UnmapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer);
-                
-                SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(m_RenderDevice.GetCommandBuffer());
-                SDL_GPUTransferBufferLocation source = {};
-                source.transfer_buffer = transferBuffer;
-                source.offset = 0;
-                
-                SDL_GPUBufferRegion destination = {};
-                destination.buffer = lineBuffer;
-                destination.offset = 0;
-                destination.size = bufferInfo.size;
-                
-                SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-                SDL_EndGPUCopyPass(copyPass);
+        // New batches go after the others. One that outgrew its range moves everything, so every
+        // slot is sent again. So does one left empty: dropping it releases its mesh and its range.
+        bool relayout = false;
+        for (StaticBatch& batch : m_StaticBatches) {
+            if (batch.capacity == 0) {
+                batch.firstSlot = m_StaticSlotCount;
+                batch.capacity = BatchCapacity(static_cast<uint32_t>(batch.instances.size()));
+                m_StaticSlotCount += batch.capacity;
             }
-            
-            m_CurrentLineBuffer = lineBuffer;
-            m_BuffersToDelete.push_back(lineBuffer);
-            m_TransferBuffersToDelete.push_back(transferBuffer);
+            relayout |= batch.instances.size() > batch.capacity || batch.instances.empty();
+        }
+        if (relayout) {
+            LayoutStaticBatches();
+        }
+        bool full = m_NeedFullInstanceUpdate.exchange(false) || relayout;
+        WriteInstanceUpdates(snapshot, full);
+
+        // World boxes of the skinned instances for frustum culling; the static ones travel with their updates
+        snapshot.skinnedBounds.Resize(static_cast<uint32_t>(snapshot.skinned.size()));
+        for (uint32_t i = 0; i < snapshot.skinned.size(); ++i) {
+            snapshot.skinnedBounds.Set(i, snapshot.skinned[i].model, snapshot.skinned[i].mesh->GetBounds());
+        }
+
+        // Joint palettes (UBO-based skinning), packed: each instance only gets the joints its mesh uses
+        for (SkinnedInstance& instance : snapshot.skinned) {
+            instance.jointCount = std::clamp(instance.mesh->GetUsedJointCount(), 1u, RenderSnapshot::MaxSkinJoints);
+        }
+        uint32_t paletteSize = 0;
+        for (const PosedInstanceRef& posed : m_PosedScratch) {
+            SkinnedInstance& instance = snapshot.skinned[posed.instance];
+            instance.paletteOffset = paletteSize;
+            paletteSize += instance.jointCount;
+        }
+        snapshot.skinPalettes.resize(paletteSize);
+
+        auto buildPalettes = [&](uint32_t begin, uint32_t end) {
+            for (uint32_t i = begin; i < end; ++i) {
+                const AnimatorComponent& anim = *m_PosedScratch[i].animator;
+                const SkinnedInstance& instance = snapshot.skinned[m_PosedScratch[i].instance];
+                glm::mat4* palette = &snapshot.skinPalettes[instance.paletteOffset];
+
+                const auto& compactIBMs = instance.mesh->GetInverseBindMatrices();
+                const auto& jointRemaps = instance.mesh->GetJointRemaps();
+                size_t skinnedJoints = std::min({ static_cast<size_t>(instance.jointCount), jointRemaps.size(), compactIBMs.size() });
+
+                // model * inverse bind in ozz's SIMD matrices; glm and ozz are both column-major
+                for (size_t compactIdx = 0; compactIdx < skinnedJoints; ++compactIdx) {
+                    uint16_t skelIdx = jointRemaps[compactIdx];
+                    if (skelIdx >= anim.models.size()) {
+                        palette[compactIdx] = glm::mat4(1.0f);
+                        continue;
+                    }
+
+                    const glm::mat4& ibm = compactIBMs[compactIdx];
+                    ozz::math::Float4x4 inverseBind = { {
+                        ozz::math::simd_float4::LoadPtrU(&ibm[0][0]),
+                        ozz::math::simd_float4::LoadPtrU(&ibm[1][0]),
+                        ozz::math::simd_float4::LoadPtrU(&ibm[2][0]),
+                        ozz::math::simd_float4::LoadPtrU(&ibm[3][0])
+                    } };
+                    ozz::math::Float4x4 skin = anim.models[skelIdx] * inverseBind;
+                    for (int c = 0; c < 4; ++c) {
+                        ozz::math::StorePtrU(skin.cols[c], &palette[compactIdx][c][0]);
+                    }
+                }
+                std::fill(palette + skinnedJoints, palette + instance.jointCount, glm::mat4(1.0f));
+            }
+        };
+
+        uint32_t posedCount = static_cast<uint32_t>(m_PosedScratch.size());
+        if (m_Context.Jobs) {
+            m_Context.Jobs->ParallelFor(posedCount, 8, buildPalettes);
         } else {
-            m_CurrentLineBuffer = nullptr;
+            buildPalettes(0, posedCount);
         }
     }
 
-    void RenderSystem::DrawScene(double alpha) {
-        (void)alpha;
-        
-        if (!m_Pipeline) return;
+    void RenderSystem::RemoveStaticSlot(uint32_t batchIndex, uint32_t index) {
+        StaticBatch& batch = m_StaticBatches[batchIndex];
+        EntitySlot& removed = m_EntitySlots[static_cast<uint32_t>(batch.entities[index])];
+        if (removed.batch == batchIndex && removed.index == index) {
+            removed = {};
+        }
+
+        // The last instance moves into the hole, so the batch's slots stay contiguous
+        uint32_t last = static_cast<uint32_t>(batch.instances.size()) - 1;
+        batch.dirtyCount -= batch.dirty[index];
+        if (index != last) {
+            batch.dirtyCount -= batch.dirty[last];
+            batch.instances[index] = batch.instances[last];
+            batch.entities[index] = batch.entities[last];
+            batch.seen[index] = batch.seen[last];
+            batch.dirty[index] = 1;
+            batch.dirtyCount++;
+
+            EntitySlot& moved = m_EntitySlots[static_cast<uint32_t>(batch.entities[index])];
+            if (moved.batch == batchIndex && moved.index == last) {
+                moved.index = index;
+            }
+        }
+        batch.instances.pop_back();
+        batch.entities.pop_back();
+        batch.seen.pop_back();
+        batch.dirty.pop_back();
+        m_OccupiedSlots--;
+    }
 
-        // Build batches first (collects all mesh instances)
-        BuildBatches();
+    void RenderSystem::LayoutStaticBatches() {
+        // Batches nothing uses any more are dropped here, which renumbers the rest
+        m_StaticBatches.erase(std::remove_if(m_StaticBatches.begin(), m_StaticBatches.end(),
+            [](const StaticBatch& batch) { return batch.instances.empty(); }), m_StaticBatches.end());
+
+        m_BatchLookup.clear();
+        m_StaticSlotCount = 0;
+        for (uint32_t b = 0; b < m_StaticBatches.size(); ++b) {
+            StaticBatch& batch = m_StaticBatches[b];
+            uint32_t count = static_cast<uint32_t>(batch.instances.size());
+            batch.firstSlot = m_StaticSlotCount;
+            batch.capacity = BatchCapacity(count);
+            m_StaticSlotCount += batch.capacity;
+
+            m_BatchLookup[batch.mesh.get()] = b;
+            for (uint32_t i = 0; i < count; ++i) {
+                m_EntitySlots[static_cast<uint32_t>(batch.entities[i])] = { b, i };
+            }
+        }
+    }
 
-        // Prepare Skinning Data (UBO-based) for animated meshes
-        std::unordered_map<uint64_t, std::vector<glm::mat4>> skinData;
-        
-        m_Context.World->query<WorldTransform, MeshComponent, AnimatorComponent>()
-            .each([&](flecs::entity e, WorldTransform& t, MeshComponent& meshComp, AnimatorComponent& anim) {
-                if (meshComp.mesh && !anim.models.empty()) {
-                    const auto& compactIBMs = meshComp.mesh->GetInverseBindMatrices();
-                    const auto& jointRemaps = meshComp.mesh->GetJointRemaps();
-                    size_t usedJointCount = jointRemaps.size();
-                    
-                    std::vector<glm::mat4> jointMatrices(256, glm::mat4(1.0f));
-                    
-                    for (size_t compactIdx = 0; compactIdx < usedJointCount && compactIdx < 256; ++compactIdx) {
-                        uint16_t skelIdx = jointRemaps[compactIdx];
-                        
-                        if (skelIdx < anim.models.size()) {
-                            glm::mat4 modelTransform;
-                            memcpy(&modelTransform, &anim.models[skelIdx], sizeof(glm::mat4));
-                            jointMatrices[compactIdx] = modelTransform * compactIBMs[compactIdx];
-                        }
-                    }
-                    
-                    skinData[e.id()] = std::move(jointMatrices);
+    void RenderSystem::WriteInstanceUpdates(RenderSnapshot& snapshot, bool full) {
+        snapshot.instanceSerial = m_ExtractSerial;
+        snapshot.fullInstanceUpdate = full;
+        snapshot.instanceSlots = m_StaticSlotCount;
+
+        for (StaticBatch& batch : m_StaticBatches) {
+            uint32_t count = static_cast<uint32_t>(batch.instances.size());
+            snapshot.batches.push_back({ batch.mesh, batch.firstSlot, count });
+            if (!full && batch.dirtyCount == 0) continue;
+
+            // Runs of changed slots, each with its instances and world boxes
+            const Resources::MeshBounds& meshBounds = batch.mesh->GetBounds();
+            for (uint32_t i = 0; i < count;) {
+                if (!full && !batch.dirty[i]) {
+                    ++i;
+                    continue;
+                }
+                uint32_t begin = i;
+                for (; i < count && (full || batch.dirty[i]); ++i) {
+                    batch.dirty[i] = 0;
                 }
+
+                uint32_t base = static_cast<uint32_t>(snapshot.instances.size());
+                snapshot.instanceUpdates.push_back({ batch.firstSlot + begin, i - begin });
+                snapshot.instances.insert(snapshot.instances.end(), batch.instances.begin() + begin, batch.instances.begin() + i);
+                snapshot.instanceBounds.Resize(base + i - begin);
+                for (uint32_t k = begin; k < i; ++k) {
+                    snapshot.instanceBounds.Set(base + k - begin, batch.instances[k].model, meshBounds);
+                }
+            }
+            batch.dirtyCount = 0;
+        }
+    }
+
+    void RenderSystem::ExtractLights(RenderSnapshot& snapshot) {
+        PROFILE_SCOPE("Extract::Lights");
+        // Directional light (last one wins)
+        m_Context.World->query<const DirectionalLight>()
+            .each([&](flecs::entity e, const DirectionalLight& light) {
+                snapshot.lightDirection = light.direction;
+                snapshot.lightIntensity = light.intensity;
+                snapshot.lightColor = light.color;
+                snapshot.ambientColor = light.ambient;
             });
 
-        // Copy Pass - upload lines and instance buffers
-        SDL_GPUCopyPass* copyPass = SDL_BeginGPUCopyPass(m_RenderDevice.GetCommandBuffer());
+        const float blend = static_cast<float>(snapshot.alpha);
+        m_Context.World->query<const WorldTransform, const PointLight, const PreviousWorldTransform*>()
+            .each([&](flecs::entity e, const WorldTransform& t, const PointLight& light, const PreviousWorldTransform* previous) {
+                glm::vec3 position = glm::vec3(t.matrix[3]);
+                if (previous && previous->valid) {
+                    position = glm::mix(glm::vec3(previous->matrix[3]), position, blend);
+                }
+                snapshot.pointLights.push_back({ position, light.radius, light.color, light.intensity, e.id() });
+            });
+
+        // Sort by entity ID for consistent ordering between frames
+        std::sort(snapshot.pointLights.begin(), snapshot.pointLights.end(),
+            [](const PointLightInstance& a, const PointLightInstance& b) { return a.entityId < b.entityId; });
+
+        // The classic forward path shades only the lights closest to the camera
+        std::vector<uint32_t>& order = m_LightOrderScratch;
+        order.resize(snapshot.pointLights.size());
+        for (uint32_t i = 0; i < order.size(); ++i) order[i] = i;
+
+        uint32_t nearestCount = std::min<uint32_t>(static_cast<uint32_t>(order.size()), RenderSnapshot::MaxNearestLights);
+        auto distSq = [&](uint32_t index) {
+            glm::vec3 d = snapshot.pointLights[index].position - snapshot.cameraPosition;
+            return glm::dot(d, d);
+        };
+        std::partial_sort(order.begin(), order.begin() + nearestCount, order.end(),
+            [&](uint32_t a, uint32_t b) { return distSq(a) < distSq(b); });
+        std::copy(order.begin(), order.begin() + nearestCount, snapshot.nearestLights);
+        snapshot.nearestLightCount = nearestCount;
 
-        // Upload Lines
-        SDL_GPUBuffer* lineBuffer = nullptr;
-        if (!m_LineVertices.empty()) {
+        // Light space matrix for the shadow map
+        glm::vec3 lightDir = glm::normalize(snapshot.lightDirection);
+
+        // Shadow frustum parameters - cover the whole play area
+        float shadowDistance = 100.0f;
+        float shadowNear = 1.0f;
+        float shadowFar = 200.0f;
+        float orthoSize = 80.0f;        // Large area
+
+        // Center shadow frustum at where camera is looking (on ground level)
+        glm::vec3 shadowCenter = glm::vec3(snapshot.shadowFocus.x, 0.0f, snapshot.shadowFocus.z);
+
+        // Light position: go OPPOSITE to light direction (light shines from lightPos toward shadowCenter)
+        glm::vec3 lightPos = shadowCenter - lightDir * shadowDistance;
+        glm::mat4 lightView = glm::lookAt(lightPos, shadowCenter, glm::vec3(0.0f, 1.0f, 0.0f));
+
+        // Orthographic projection - use ZO (zero-to-one) for Vulkan's depth range
+        glm::mat4 lightProj = glm::orthoZO(-orthoSize, orthoSize, -orthoSize, orthoSize, shadowNear, shadowFar);
+
+        snapshot.lightSpaceMatrix = lightProj * lightView;
+    }
+
+    void RenderSnapshot::Clear() {
+        // Back to defaults, but keep the containers' capacity
+        RenderSnapshot fresh;
+        fresh.pointLights = std::move(pointLights);
+        fresh.sprites = std::move(sprites);
+        fresh.batches = std::move(batches);
+        fresh.instances = std::move(instances);
+        fresh.instanceUpdates = std::move(instanceUpdates);
+        fresh.instanceBounds = std::move(instanceBounds);
+        fresh.skinned = std::move(skinned);
+        fresh.skinnedBounds = std::move(skinnedBounds);
+        fresh.skinPalettes = std::move(skinPalettes);
+        fresh.lines = std::move(lines);
+        *this = std::move(fresh);
+
+        pointLights.clear();
+        sprites.clear();
+        batches.clear();
+        instances.clear();
+        instanceUpdates.clear();
+        instanceBounds.Clear();
+        skinned.clear();
+        skinnedBounds.Clear();
+        skinPalettes.clear();
+        lines.clear();
+    }
+
+    void RenderSystem::ApplyInstanceUpdates(const RenderSnapshot& snapshot) {
+        // Snapshots carry changes since the one before; if one was never drawn, ask for everything again.
+        // Until that arrives, the slots it changed keep their older contents.
+        if (!snapshot.fullInstanceUpdate && snapshot.instanceSerial != m_AppliedInstanceSerial + 1) {
+            m_NeedFullInstanceUpdate.store(true);
+        }
+        m_AppliedInstanceSerial = snapshot.instanceSerial;
+
+        m_SlotBounds.Resize(snapshot.instanceSlots);
+        uint32_t source = 0;
+        for (const InstanceRange& range : snapshot.instanceUpdates) {
+            for (uint32_t i = 0; i < range.count; ++i, ++source) {
+                m_SlotBounds.centerX[range.firstSlot + i] = snapshot.instanceBounds.centerX[source];
+                m_SlotBounds.centerY[range.firstSlot + i] = snapshot.instanceBounds.centerY[source];
+                m_SlotBounds.centerZ[range.firstSlot + i] = snapshot.instanceBounds.centerZ[source];
+                m_SlotBounds.extentX[range.firstSlot + i] = snapshot.instanceBounds.extentX[source];
+                m_SlotBounds.extentY[range.firstSlot + i] = snapshot.instanceBounds.extentY[source];
+                m_SlotBounds.extentZ[range.firstSlot + i] = snapshot.instanceBounds.extentZ[source];
+            }
+        }
+    }
+
+    void RenderSystem::CullView(const RenderSnapshot& snapshot, const glm::mat4& viewProj, CulledView& view, uint32_t& offset) {
+        PROFILE_SCOPE("Render::FrustumCulling");
+        constexpr uint32_t BoxesPerJob = 4096;
+        // Culled instances between two visible runs shorter than this are copied and drawn anyway,
+        // which saves a copy command
+        constexpr uint32_t MaxSkippedGap = 8;
+
+        Frustum frustum = Frustum::FromMatrix(viewProj);
+        uint32_t slotCount = snapshot.instanceSlots;
+        view.visible.resize(slotCount);
+        auto cull = [&](uint32_t begin, uint32_t end) {
+            FrustumCulling::Cull(frustum, m_SlotBounds, begin, end, view.visible.data());
+        };
+        if (m_Context.Jobs && slotCount > BoxesPerJob) {
+            m_Context.Jobs->ParallelFor(slotCount, BoxesPerJob, cull);
+        } else {
+            cull(0, slotCount);
+        }
+        uint32_t skinnedCount = snapshot.skinnedBounds.Size();
+        view.skinnedVisible.resize(skinnedCount);
+        FrustumCulling::Cull(frustum, snapshot.skinnedBounds, 0, skinnedCount, view.skinnedVisible.data());
+
+        // Each batch's visible runs of slots are copied together into the view's range
+        view.batches.resize(snapshot.batches.size());
+        view.copies.clear();
+        uint32_t visibleCount = 0;
+        for (size_t b = 0; b < snapshot.batches.size(); ++b) {
+            const MeshBatch& source = snapshot.batches[b];
+            uint32_t batchOffset = offset;
+            uint32_t end = source.instanceOffset + source.instanceCount;
+            for (uint32_t slot = source.instanceOffset; slot < end;) {
+                if (!view.visible[slot]) {
+                    ++slot;
+                    continue;
+                }
+                uint32_t runBegin = slot;
+                uint32_t runEnd = slot;
+                while (slot < end) {
+                    if (view.visible[slot]) {
+                        runEnd = ++slot;
+                        visibleCount++;
+                    } else if (slot - runEnd < MaxSkippedGap) {
+                        ++slot;
+                    } else {
+                        break;
+                    }
+                }
+                view.copies.push_back({ runBegin, offset, runEnd - runBegin });
+                offset += runEnd - runBegin;
+            }
+            view.batches[b] = { source.mesh, batchOffset, offset - batchOffset };
+        }
+
+        uint32_t visibleSkinned = 0;
+        for (uint8_t visible : view.skinnedVisible) {
+            visibleSkinned += visible;
+        }
+        uint32_t staticCount = 0;
+        for (const MeshBatch& batch : snapshot.batches) {
+            staticCount += batch.instanceCount;
+        }
+        view.culled = staticCount + skinnedCount - visibleCount - visibleSkinned;
+    }
+
+    void RenderSystem::UploadInstances(const RenderSnapshot& snapshot, uint32_t viewInstances) {
+        // The slots outlive the buffer: a bigger one starts as a GPU copy of the old one
+        if (snapshot.instanceSlots > m_InstanceBufferCapacity) {
+            // Grow by 50% extra to avoid frequent reallocations
+            uint32_t capacity = snapshot.instanceSlots + snapshot.instanceSlots / 2;
             SDL_GPUBufferCreateInfo bufferInfo = {};
             bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
-            bufferInfo.size = m_LineVertices.size() * sizeof(LineVertex);
-            
-            lineBuffer = SDL_CreateGPUBuffer(m_RenderDevice.GetDevice(), &bufferInfo);
-            
-            SDL_GPUTransferBufferCreateInfo transferInfo = {};
-            transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-            transferInfo.size = bufferInfo.size;
-            
-            SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_RenderDevice.GetDevice(), &transferInfo);
-            
-            Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer, false);
-            memcpy(map, m_LineVertices.data(), bufferInfo.size);
-            SDL_UnmapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer);
-            
-            SDL_GPUTransferBufferLocation source = {};
-            source.transfer_buffer = transferBuffer;
-            source.offset = 0;
-            
-            SDL_GPUBufferRegion destination = {};
-            destination.buffer = lineBuffer;
-            destination.offset = 0;
-            destination.size = bufferInfo.size;
-            
-            SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-            
-            m_BuffersToDelete.push_back(lineBuffer);
-            m_TransferBuffersToDelete.push_back(transferBuffer);
+            bufferInfo.size = capacity * sizeof(MeshInstance);
+            SDL_GPUBuffer* buffer = m_RenderDevice.CreateBuffer(&bufferInfo);
+
+            if (buffer && m_InstanceBuffer) {
+                m_RenderDevice.QueueBufferCopy(m_InstanceBuffer, 0, buffer, 0, m_InstanceBufferCapacity * sizeof(MeshInstance));
+            }
+            if (m_InstanceBuffer) {
+                m_BuffersToDelete.push_back(m_InstanceBuffer);
+            }
+            m_InstanceBuffer = buffer;
+            m_InstanceBufferCapacity = buffer ? capacity : 0;
+            LOG_CORE_INFO("Resized instance buffer to {} slots ({} bytes)", capacity, bufferInfo.size);
         }
-        m_CurrentLineBuffer = lineBuffer;
 
-        // Upload Instance Buffer for all batched static meshes (shared buffer)
-        // First, calculate total instance count and assign offsets
-        uint32_t totalInstances = 0;
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (batch.instances.empty()) continue;
-            batch.instanceOffset = totalInstances;
-            totalInstances += static_cast<uint32_t>(batch.instances.size());
+        if (viewInstances > m_ViewInstanceBufferCapacity) {
+            if (m_ViewInstanceBuffer) {
+                m_BuffersToDelete.push_back(m_ViewInstanceBuffer);
+            }
+            uint32_t capacity = viewInstances + viewInstances / 2;
+            SDL_GPUBufferCreateInfo bufferInfo = {};
+            bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
+            bufferInfo.size = capacity * sizeof(MeshInstance);
+            m_ViewInstanceBuffer = m_RenderDevice.CreateBuffer(&bufferInfo);
+            m_ViewInstanceBufferCapacity = m_ViewInstanceBuffer ? capacity : 0;
         }
-        
-        if (totalInstances > 0) {
-            size_t requiredSize = totalInstances * sizeof(MeshInstance);
-            
-            // Resize persistent instance buffer if needed
-            if (requiredSize > m_InstanceBufferCapacity) {
-                if (m_InstanceBuffer) {
-                    m_BuffersToDelete.push_back(m_InstanceBuffer);
+        if (!m_InstanceBuffer) {
+            if (!snapshot.instances.empty()) m_NeedFullInstanceUpdate.store(true);
+            return;
+        }
+
+        // Changed slots only; a static scene uploads nothing
+        uint32_t source = 0;
+        for (const InstanceRange& range : snapshot.instanceUpdates) {
+            if (!m_RenderDevice.UploadBuffer(m_InstanceBuffer, range.firstSlot * sizeof(MeshInstance),
+                                             &snapshot.instances[source], range.count * sizeof(MeshInstance))) {
+                m_NeedFullInstanceUpdate.store(true);
+                break;
+            }
+            source += range.count;
+        }
+
+        // Then each view's visible runs, copied on the GPU
+        if (!m_ViewInstanceBuffer) return;
+        for (const CulledView* view : { &m_CameraView, &m_ShadowView }) {
+            for (const SlotCopy& copy : view->copies) {
+                m_RenderDevice.QueueBufferCopy(m_InstanceBuffer, copy.firstSlot * sizeof(MeshInstance),
+                                               m_ViewInstanceBuffer, copy.offset * sizeof(MeshInstance),
+                                               copy.count * sizeof(MeshInstance));
+            }
+        }
+    }
+
+    void RenderSystem::BeginFrame() {
+        // Cleanup resources from previous frames
+        for (auto b : m_BuffersToDelete) m_RenderDevice.ReleaseBuffer(b);
+        m_BuffersToDelete.clear();
+
+        // Acquires the command buffer and swapchain texture; the render pass starts in DrawScene
+        // after the copy pass has uploaded this frame's lines and instances
+        m_RenderDevice.BeginFrame();
+    }
+
+    void RenderSystem::DrawScene(const RenderSnapshot& snapshot) {
+        if (!m_Pipeline) return;
+
+        m_Stats.Reset();
+        m_Stats.totalInstances = snapshot.totalInstances;
+        m_Stats.skinnedInstances = static_cast<uint32_t>(snapshot.skinned.size());
+        for (const MeshBatch& batch : snapshot.batches) {
+            m_Stats.batchedInstances += batch.instanceCount;
+        }
+        m_Stats.updatedInstances = static_cast<uint32_t>(snapshot.instances.size());
+        m_Stats.lineVertices = static_cast<uint32_t>(snapshot.lines.size());
+        m_Stats.pointLights = static_cast<uint32_t>(snapshot.pointLights.size());
+
+        // Get camera matrices for all passes
+        const glm::mat4& view = snapshot.view;
+        const glm::vec3& cameraPosition = snapshot.cameraPosition;
+        glm::mat4 proj = glm::perspectiveRH_ZO(glm::radians(snapshot.fov), m_RenderDevice.GetAspectRatio(),
+                                               snapshot.nearPlane, snapshot.farPlane);
+
+        // Frustum culling, per view; each view gets its own copy of its visible instances.
+        // The depth pre-pass draws the camera's set.
+        ApplyInstanceUpdates(snapshot);
+        uint32_t viewInstances = 0;
+        CullView(snapshot, proj * view, m_CameraView, viewInstances);
+        m_Stats.culledInstances = m_CameraView.culled;
+        if (m_RenderDevice.IsShadowsEnabled()) {
+            CullView(snapshot, snapshot.lightSpaceMatrix, m_ShadowView, viewInstances);
+            m_Stats.shadowCulledInstances = m_ShadowView.culled;
+        } else {
+            m_ShadowView.batches.clear();
+            m_ShadowView.copies.clear();
+        }
+
+        // Upload Lines. The buffer is rewritten whole every frame, so it cycles if the GPU still reads it.
+        if (!snapshot.lines.empty()) {
+            uint32_t lineCount = static_cast<uint32_t>(snapshot.lines.size());
+            if (lineCount > m_LineBufferCapacity) {
+                if (m_LineBuffer) {
+                    m_BuffersToDelete.push_back(m_LineBuffer);
                 }
-                
-                // Grow by 50% extra to avoid frequent reallocations
-                size_t newCapacity = static_cast<size_t>(requiredSize * 1.5);
-                
+                uint32_t capacity = lineCount + lineCount / 2;
                 SDL_GPUBufferCreateInfo bufferInfo = {};
                 bufferInfo.usage = SDL_GPU_BUFFERUSAGE_VERTEX;
-                bufferInfo.size = newCapacity;
-                
-                m_InstanceBuffer = SDL_CreateGPUBuffer(m_RenderDevice.GetDevice(), &bufferInfo);
-                m_InstanceBufferCapacity = static_cast<uint32_t>(newCapacity);
-                
-                LOG_CORE_INFO("Resized instance buffer to {} instances ({} bytes)", 
-                              newCapacity / sizeof(MeshInstance), newCapacity);
+                bufferInfo.size = capacity * sizeof(LineVertex);
+                m_LineBuffer = m_RenderDevice.CreateBuffer(&bufferInfo);
+                m_LineBufferCapacity = m_LineBuffer ? capacity : 0;
             }
-            
-            if (m_InstanceBuffer) {
-                // Create transfer buffer and pack all instances
-                SDL_GPUTransferBufferCreateInfo transferInfo = {};
-                transferInfo.usage = SDL_GPU_TRANSFERBUFFERUSAGE_UPLOAD;
-                transferInfo.size = requiredSize;
-                
-                SDL_GPUTransferBuffer* transferBuffer = SDL_CreateGPUTransferBuffer(m_RenderDevice.GetDevice(), &transferInfo);
-                if (transferBuffer) {
-                    Uint8* map = (Uint8*)SDL_MapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer, false);
-                    
-                    // Pack all batch instances into contiguous memory
-                    size_t offset = 0;
-                    for (auto& [meshPtr, batch] : m_Batches) {
-                        if (batch.instances.empty()) continue;
-                        size_t batchSize = batch.instances.size() * sizeof(MeshInstance);
-                        memcpy(map + offset, batch.instances.data(), batchSize);
-                        offset += batchSize;
-                    }
-                    
-                    SDL_UnmapGPUTransferBuffer(m_RenderDevice.GetDevice(), transferBuffer);
-                    
-                    SDL_GPUTransferBufferLocation source = {};
-                    source.transfer_buffer = transferBuffer;
-                    source.offset = 0;
-                    
-                    SDL_GPUBufferRegion destination = {};
-                    destination.buffer = m_InstanceBuffer;
-                    destination.offset = 0;
-                    destination.size = requiredSize;
-                    
-                    SDL_UploadToGPUBuffer(copyPass, &source, &destination, false);
-                    
-                    m_TransferBuffersToDelete.push_back(transferBuffer);
-                }
+            if (m_LineBuffer) {
+                m_RenderDevice.UploadBuffer(m_LineBuffer, 0, snapshot.lines.data(), lineCount * sizeof(LineVertex), true);
             }
         }
 
-        SDL_EndGPUCopyPass(copyPass);
+        // Changed instance slots, then every view's visible instances
+        UploadInstances(snapshot, viewInstances);
 
-        // Get camera matrices for all passes
-        glm::mat4 view = glm::mat4(1.0f);
-        glm::mat4 proj = glm::mat4(1.0f);
-        glm::vec3 cameraPosition = glm::vec3(0, 2, 5);
-        float aspectRatio = m_RenderDevice.GetWindow()->GetAspectRatio();
-        
-        bool cameraFound = false;
-        m_Context.World->query<LocalTransform, const CameraComponent>()
-            .each([&](flecs::entity e, LocalTransform& t, const CameraComponent& cam) {
-                if (cam.isPrimary && !cameraFound) {
-                    cameraPosition = t.position;
-                    glm::mat4 camMatrix = glm::translate(glm::mat4(1.0f), t.position);
-                    camMatrix = glm::rotate(camMatrix, glm::radians(t.rotation.y), glm::vec3(0, 1, 0));
-                    camMatrix = glm::rotate(camMatrix, glm::radians(t.rotation.x), glm::vec3(1, 0, 0));
-                    camMatrix = glm::rotate(camMatrix, glm::radians(t.rotation.z), glm::vec3(0, 0, 1));
-                    view = glm::inverse(camMatrix);
-                    proj = glm::perspectiveRH_ZO(glm::radians(cam.fov), aspectRatio, cam.nearPlane, cam.farPlane);
-                    cameraFound = true;
-                }
-            });
-        
-        if (!cameraFound) {
-            view = glm::lookAt(glm::vec3(0, 2, 5), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
-            proj = glm::perspectiveRH_ZO(glm::radians(45.0f), aspectRatio, 0.1f, 100.0f);
+        // Forward+ light list
+        if (m_RenderDevice.IsForwardPlusEnabled()) {
+            UpdateLightBufferForForwardPlus(snapshot);
         }
-        
+
+        // Everything staged since the last frame, resource loads included, in one copy pass
+        m_RenderDevice.FlushUploads();
+
         // Cache matrices for post-processing passes (SSGI, etc.)
         m_CurrentView = view;
         m_CurrentProj = proj;
+        m_LightSpaceMatrix = snapshot.lightSpaceMatrix;
 
         // Forward+ passes (depth pre-pass + light culling)
         if (m_RenderDevice.IsForwardPlusEnabled()) {
-            // Update light buffer for light culling
-            UpdateLightBufferForForwardPlus();
-            
             // 2a. Depth Pre-Pass
-            RenderDepthPrePass(view, proj);
+            RenderDepthPrePass(snapshot, view, proj);
             
             // 2b. Light Culling Compute Pass
             DispatchLightCulling(view, proj);
@@ -1976,7 +2320,7 @@ namespace Systems {
         
         // Shadow Pass (render scene from light's perspective)
         if (m_RenderDevice.IsShadowsEnabled()) {
-            RenderShadowPass(skinData);
+            RenderShadowPass(snapshot);
         }
 
         // 3. Begin Main Render Pass
@@ -1985,31 +2329,27 @@ namespace Systems {
 
         if (pass) {
             // Draw Sprites
-            SDL_BindGPUGraphicsPipeline(pass, m_Pipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_Pipeline);
             
-            m_Context.World->query<WorldTransform, SpriteComponent>()
-                .each([&](flecs::entity e, WorldTransform& t, SpriteComponent& s) {
-                if (s.texture) {
-                    glm::mat4 model = t.matrix;
-                    SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &model, sizeof(model));
+            for (const SpriteInstance& sprite : snapshot.sprites) {
+                m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &sprite.model, sizeof(sprite.model));
 
-                    SDL_GPUTextureSamplerBinding binding;
-                    binding.texture = s.texture->GetGPUTexture();
-                    binding.sampler = m_Sampler;
-                    
-                    SDL_BindGPUFragmentSamplers(pass, 0, &binding, 1);
-                    SDL_DrawGPUPrimitives(pass, 4, 1, 0, 0);
-                }
-            });
+                SDL_GPUTextureSamplerBinding binding;
+                binding.texture = sprite.texture->GetGPUTexture();
+                binding.sampler = m_Sampler;
+                
+                m_RenderDevice.BindFragmentSamplers(pass, 0, &binding, 1);
+                m_RenderDevice.DrawPrimitives(pass, 4, 1, 0, 0);
+            }
 
             // Draw Meshes
             if (m_MeshPipeline) {
-                SDL_BindGPUGraphicsPipeline(pass, m_MeshPipeline);
+                m_RenderDevice.BindGraphicsPipeline(pass, m_MeshPipeline);
 
                 // Camera matrices (view/proj) already calculated before render pass
 
                 // Gather lights
-                constexpr int MAX_POINT_LIGHTS = 8;
+                constexpr int MAX_POINT_LIGHTS = RenderSnapshot::MaxNearestLights;
                 
                 struct LightUBO {
                     glm::vec4 dirLightDir;      // xyz = direction, w = intensity
@@ -2029,51 +2369,20 @@ namespace Systems {
                     int32_t shadowsEnabled;
                 } lightUbo;
                 
-                // Default directional light
-                lightUbo.dirLightDir = glm::vec4(-0.5f, -1.0f, -0.3f, 1.0f);
-                lightUbo.dirLightColor = glm::vec4(1.0f, 0.95f, 0.9f, 1.0f);
-                lightUbo.ambientColor = glm::vec4(0.15f, 0.15f, 0.2f, 1.0f);
+                lightUbo.dirLightDir = glm::vec4(snapshot.lightDirection, snapshot.lightIntensity);
+                lightUbo.dirLightColor = glm::vec4(snapshot.lightColor, 1.0f);
+                lightUbo.ambientColor = glm::vec4(snapshot.ambientColor, 1.0f);
                 lightUbo.cameraPos = glm::vec4(cameraPosition, 1.0f);
                 lightUbo.numPointLights = 0;
                 lightUbo.shininess = 32.0f;
                 
-                // Query directional lights (use first one found)
-                m_Context.World->query<const DirectionalLight>()
-                    .each([&](flecs::entity e, const DirectionalLight& light) {
-                        lightUbo.dirLightDir = glm::vec4(light.direction, light.intensity);
-                        lightUbo.dirLightColor = glm::vec4(light.color, 1.0f);
-                        lightUbo.ambientColor = glm::vec4(light.ambient, 1.0f);
-                    });
-                
-                // Query point lights - collect all and sort by distance to camera
-                struct LightInfo {
-                    glm::vec3 pos;
-                    float radius;
-                    glm::vec3 color;
-                    float intensity;
-                    float distSq;
-                };
-                std::vector<LightInfo> allLights;
-                m_Context.World->query<const WorldTransform, const PointLight>()
-                    .each([&](flecs::entity e, const WorldTransform& t, const PointLight& light) {
-                        glm::vec3 pos = glm::vec3(t.matrix[3]);
-                        float distSq = glm::dot(pos - cameraPosition, pos - cameraPosition);
-                        allLights.push_back({pos, light.radius, light.color, light.intensity, distSq});
-                    });
-                
-                // Sort by distance (closest first)
-                std::sort(allLights.begin(), allLights.end(), 
-                    [](const LightInfo& a, const LightInfo& b) { return a.distSq < b.distSq; });
-                
-                // Take up to MAX_POINT_LIGHTS closest
-                int pointLightIdx = 0;
-                for (const auto& light : allLights) {
-                    if (pointLightIdx >= MAX_POINT_LIGHTS) break;
-                    lightUbo.pointLightPos[pointLightIdx] = glm::vec4(light.pos, light.radius);
-                    lightUbo.pointLightColor[pointLightIdx] = glm::vec4(light.color, light.intensity);
-                    pointLightIdx++;
+                // Closest point lights, picked during extraction
+                for (uint32_t i = 0; i < snapshot.nearestLightCount; ++i) {
+                    const PointLightInstance& light = snapshot.pointLights[snapshot.nearestLights[i]];
+                    lightUbo.pointLightPos[i] = glm::vec4(light.position, light.radius);
+                    lightUbo.pointLightColor[i] = glm::vec4(light.color, light.intensity);
                 }
-                lightUbo.numPointLights = pointLightIdx;
+                lightUbo.numPointLights = static_cast<int>(snapshot.nearestLightCount);
                 
                 // Shadow parameters
                 lightUbo.lightSpaceMatrix = m_LightSpaceMatrix;
@@ -2087,20 +2396,20 @@ namespace Systems {
                     // Use Forward+ path with tile-based light culling
                     static bool loggedPath = false;
                     if (!loggedPath) { LOG_CORE_INFO("Using Forward+ rendering path"); loggedPath = true; }
-                    RenderBatchesForwardPlus(pass, view, proj);
+                    RenderBatchesForwardPlus(snapshot, pass, view, proj);
                 } else {
                     // Traditional forward path (limited to 8 point lights)
                     static bool loggedPath2 = false;
                     if (!loggedPath2) { LOG_CORE_INFO("Using Traditional rendering path"); loggedPath2 = true; }
-                    RenderBatches(pass, view, proj, &lightUbo, sizeof(lightUbo));
+                    RenderBatches(snapshot, pass, view, proj, &lightUbo, sizeof(lightUbo));
                 }
                 
                 // Render skinned/animated meshes (still uses regular pipeline for now)
-                RenderSkinnedMeshes(pass, view, proj, &lightUbo, sizeof(lightUbo), skinData);
+                RenderSkinnedMeshes(snapshot, pass, view, proj, &lightUbo, sizeof(lightUbo));
 
                 // Render Lines
-                if (m_LinePipeline && m_CurrentLineBuffer && !m_LineVertices.empty()) {
-                    SDL_BindGPUGraphicsPipeline(pass, m_LinePipeline);
+                if (m_LinePipeline && m_LineBuffer && !snapshot.lines.empty()) {
+                    m_RenderDevice.BindGraphicsPipeline(pass, m_LinePipeline);
                     
                     struct UBO {
                         glm::mat4 view;
@@ -2110,18 +2419,16 @@ namespace Systems {
                     ubo.view = view;
                     ubo.proj = proj;
                     
-                    SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &ubo, sizeof(ubo));
+                    m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &ubo, sizeof(ubo));
                     
                     SDL_GPUBufferBinding binding = {};
-                    binding.buffer = m_CurrentLineBuffer;
+                    binding.buffer = m_LineBuffer;
                     binding.offset = 0;
                     
-                    SDL_BindGPUVertexBuffers(pass, 0, &binding, 1);
-                    SDL_DrawGPUPrimitives(pass, m_LineVertices.size(), 1, 0, 0);
+                    m_RenderDevice.BindVertexBuffers(pass, 0, &binding, 1);
+                    m_RenderDevice.DrawPrimitives(pass, static_cast<Uint32>(snapshot.lines.size()), 1, 0, 0);
                 }
             }
-            
-            m_LineVertices.clear();
         }
     }
 
@@ -2248,7 +2555,8 @@ namespace Systems {
         }
     }
 
-    void RenderSystem::DrawPhysicsDebug() {
+    void RenderSystem::ExtractPhysicsDebug() {
+        PROFILE_SCOPE("Extract::PhysicsDebug");
         // Draw colliders for all entities with Collider component
         m_Context.World->query<const LocalTransform, const Collider>()
             .each([this](flecs::entity e, const LocalTransform& transform, const Collider& collider) {
@@ -2265,7 +2573,7 @@ namespace Systems {
                 }
                 
                 glm::vec3 center = transform.position + collider.offset;
-                glm::quat rotation = glm::quat(glm::radians(transform.rotation));
+                const glm::quat& rotation = transform.rotation;
                 
                 switch (collider.type) {
                     case ColliderType::Box:
@@ -2295,64 +2603,16 @@ namespace Systems {
             });
     }
 
-    void RenderSystem::BuildBatches() {
-        m_Batches.clear();
-        m_Stats.Reset();
-        
-        m_Context.World->query<WorldTransform, MeshComponent>()
-            .each([&](flecs::entity e, WorldTransform& t, MeshComponent& meshComp) {
-                if (!meshComp.mesh) return;
-                
-                m_Stats.totalInstances++;
-                
-                // Check if entity has animation/skinning - skip for batching
-                bool hasSkinning = e.has<AnimatorComponent>() && e.get<AnimatorComponent>().skeleton;
-                
-                if (hasSkinning) {
-                    m_Stats.skinnedInstances++;
-                    return;  // Skinned meshes are rendered separately, not batched
-                }
-                
-                m_Stats.batchedInstances++;
-                
-                Resources::Mesh* meshPtr = meshComp.mesh.get();
-                
-                // Get or create batch for this mesh
-                auto& batch = m_Batches[meshPtr];
-                batch.mesh = meshComp.mesh;
-                
-                // Build model matrix with render offset
-                glm::mat4 model = t.matrix;
-                if (meshComp.renderOffset != glm::vec3(0.0f)) {
-                    model = glm::translate(model, meshComp.renderOffset);
-                }
-                
-                MeshInstance instance;
-                instance.model = model;
-                instance.color = glm::vec4(1.0f);  // Default white, could use material color
-                
-                batch.instances.push_back(instance);
-            });
-    }
-
-    void RenderSystem::RenderBatches(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, 
+    void RenderSystem::RenderBatches(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, 
                                       const void* lightUbo, size_t lightUboSize) {
-        if (!m_InstancedMeshPipeline || !m_InstanceBuffer) {
+        PROFILE_SCOPE("Render::Batches");
+        if (!m_InstancedMeshPipeline || !m_ViewInstanceBuffer) {
             return;
         }
         
-        // Check if we have any batches to render
-        bool hasBatches = false;
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (!batch.instances.empty()) {
-                hasBatches = true;
-                break;
-            }
-        }
+        if (snapshot.batches.empty()) return;
         
-        if (!hasBatches) return;
-        
-        SDL_BindGPUGraphicsPipeline(pass, m_InstancedMeshPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_InstancedMeshPipeline);
         
         // Push ViewProj uniform
         struct ViewProjUBO {
@@ -2362,39 +2622,40 @@ namespace Systems {
         viewProjUbo.view = view;
         viewProjUbo.proj = proj;
         
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (batch.instances.empty()) continue;
+        for (const MeshBatch& batch : m_CameraView.batches) {
+            if (batch.instanceCount == 0) continue;
             
             // Push uniforms per batch
-            SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &viewProjUbo, sizeof(viewProjUbo));
-            SDL_PushGPUFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, lightUbo, lightUboSize);
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &viewProjUbo, sizeof(viewProjUbo));
+            m_RenderDevice.PushFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, lightUbo, lightUboSize);
             
             // Bind vertex buffers (mesh vertices + instance data with offset)
             SDL_GPUBufferBinding bindings[2];
             bindings[0].buffer = batch.mesh->GetVertexBuffer();
             bindings[0].offset = 0;
-            bindings[1].buffer = m_InstanceBuffer;
+            bindings[1].buffer = m_ViewInstanceBuffer;
             bindings[1].offset = batch.instanceOffset * sizeof(MeshInstance);
             
-            SDL_BindGPUVertexBuffers(pass, 0, bindings, 2);
+            m_RenderDevice.BindVertexBuffers(pass, 0, bindings, 2);
             
             // Bind index buffer
             SDL_GPUBufferBinding indexBinding;
             indexBinding.buffer = batch.mesh->GetIndexBuffer();
             indexBinding.offset = 0;
-            SDL_BindGPUIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            m_RenderDevice.BindIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
             
             // Draw instanced
             Uint32 indexCount = batch.mesh->GetIndexCount();
-            Uint32 instanceCount = static_cast<Uint32>(batch.instances.size());
-            SDL_DrawGPUIndexedPrimitives(pass, indexCount, instanceCount, 0, 0, 0);
+            Uint32 instanceCount = batch.instanceCount;
+            m_RenderDevice.DrawIndexedPrimitives(pass, indexCount, instanceCount, 0, 0, 0);
             
             m_Stats.drawCalls++;
         }
     }
 
-    void RenderSystem::RenderBatchesForwardPlus(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj) {
-        if (!m_ForwardPlusPipeline || !m_InstanceBuffer) {
+    void RenderSystem::RenderBatchesForwardPlus(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj) {
+        PROFILE_SCOPE("Render::Batches");
+        if (!m_ForwardPlusPipeline || !m_ViewInstanceBuffer) {
             return;
         }
         
@@ -2406,18 +2667,9 @@ namespace Systems {
             return;
         }
         
-        // Check if we have any batches to render
-        bool hasBatches = false;
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (!batch.instances.empty()) {
-                hasBatches = true;
-                break;
-            }
-        }
-        
-        if (!hasBatches) return;
+        if (snapshot.batches.empty()) return;
         
-        SDL_BindGPUGraphicsPipeline(pass, m_ForwardPlusPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_ForwardPlusPipeline);
         
         // SDL_GPU requires samplers to be bound first, then storage buffers
         // Shader layout: binding 0 = shadow sampler, binding 1 = light buffer, binding 2 = tile indices
@@ -2429,12 +2681,12 @@ namespace Systems {
             SDL_GPUTextureSamplerBinding shadowBinding = {};
             shadowBinding.texture = shadowMapTex;
             shadowBinding.sampler = shadowSampler;
-            SDL_BindGPUFragmentSamplers(pass, 0, &shadowBinding, 1);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, &shadowBinding, 1);
         }
         
         // Bind storage buffers (light buffer and tile indices) - Fragment set 2, bindings 1 and 2
         SDL_GPUBuffer* storageBuffers[2] = { lightBuffer, tileBuffer };
-        SDL_BindGPUFragmentStorageBuffers(pass, 0, storageBuffers, 2);
+        m_RenderDevice.BindFragmentStorageBuffers(pass, 0, storageBuffers, 2);
         
         // Prepare uniforms
         struct ViewProjUBO {
@@ -2473,11 +2725,10 @@ namespace Systems {
             loggedOnce = true;
         }
         
-        // Default values
-        fragUbo.dirLightDir = glm::vec4(-0.5f, -1.0f, -0.3f, 1.0f);
-        fragUbo.dirLightColor = glm::vec4(1.0f, 0.95f, 0.9f, 1.0f);
-        fragUbo.ambientColor = glm::vec4(0.15f, 0.15f, 0.2f, 1.0f);
-        fragUbo.cameraPos = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+        fragUbo.dirLightDir = glm::vec4(snapshot.lightDirection, snapshot.lightIntensity);
+        fragUbo.dirLightColor = glm::vec4(snapshot.lightColor, 1.0f);
+        fragUbo.ambientColor = glm::vec4(snapshot.ambientColor, 1.0f);
+        fragUbo.cameraPos = glm::vec4(snapshot.hasCamera ? snapshot.cameraPosition : glm::vec3(0.0f), 1.0f);
         float screenW = static_cast<float>(m_RenderDevice.GetRenderWidth());
         float screenH = static_cast<float>(m_RenderDevice.GetRenderHeight());
         fragUbo.screenSize = glm::vec4(screenW, screenH, 1.0f / screenW, 1.0f / screenH);
@@ -2491,118 +2742,93 @@ namespace Systems {
         
         fragUbo.shininess = 32.0f;
         
-        // Query directional light
-        m_Context.World->query<const DirectionalLight>()
-            .each([&](flecs::entity e, const DirectionalLight& light) {
-                fragUbo.dirLightDir = glm::vec4(light.direction, light.intensity);
-                fragUbo.dirLightColor = glm::vec4(light.color, 1.0f);
-                fragUbo.ambientColor = glm::vec4(light.ambient, 1.0f);
-            });
-        
-        // Get camera position
-        m_Context.World->query<LocalTransform, const CameraComponent>()
-            .each([&](flecs::entity e, LocalTransform& t, const CameraComponent& cam) {
-                if (cam.isPrimary) {
-                    fragUbo.cameraPos = glm::vec4(t.position, 1.0f);
-                }
-            });
-        
-        for (auto& [meshPtr, batch] : m_Batches) {
-            if (batch.instances.empty()) continue;
+        for (const MeshBatch& batch : m_CameraView.batches) {
+            if (batch.instanceCount == 0) continue;
             
             // Push uniforms per batch
-            SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &viewProjUbo, sizeof(viewProjUbo));
-            SDL_PushGPUFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, &fragUbo, sizeof(fragUbo));
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &viewProjUbo, sizeof(viewProjUbo));
+            m_RenderDevice.PushFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, &fragUbo, sizeof(fragUbo));
             
             // Bind vertex buffers (mesh vertices + instance data with offset)
             SDL_GPUBufferBinding bindings[2];
             bindings[0].buffer = batch.mesh->GetVertexBuffer();
             bindings[0].offset = 0;
-            bindings[1].buffer = m_InstanceBuffer;
+            bindings[1].buffer = m_ViewInstanceBuffer;
             bindings[1].offset = batch.instanceOffset * sizeof(MeshInstance);
             
-            SDL_BindGPUVertexBuffers(pass, 0, bindings, 2);
+            m_RenderDevice.BindVertexBuffers(pass, 0, bindings, 2);
             
             // Bind index buffer
             SDL_GPUBufferBinding indexBinding;
             indexBinding.buffer = batch.mesh->GetIndexBuffer();
             indexBinding.offset = 0;
-            SDL_BindGPUIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            m_RenderDevice.BindIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
             
             // Draw instanced
             Uint32 indexCount = batch.mesh->GetIndexCount();
-            Uint32 instanceCount = static_cast<Uint32>(batch.instances.size());
-            SDL_DrawGPUIndexedPrimitives(pass, indexCount, instanceCount, 0, 0, 0);
+            Uint32 instanceCount = batch.instanceCount;
+            m_RenderDevice.DrawIndexedPrimitives(pass, indexCount, instanceCount, 0, 0, 0);
             
             m_Stats.drawCalls++;
         }
     }
 
-    void RenderSystem::RenderSkinnedMeshes(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj,
-                                            const void* lightUbo, size_t lightUboSize,
-                                            const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData) {
+    void RenderSystem::RenderSkinnedMeshes(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj,
+                                            const void* lightUbo, size_t lightUboSize) {
+        PROFILE_SCOPE("Render::SkinnedMeshes");
         if (!m_MeshPipeline) return;
         
-        SDL_BindGPUGraphicsPipeline(pass, m_MeshPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_MeshPipeline);
         
-        m_Context.World->query<WorldTransform, MeshComponent, AnimatorComponent>()
-            .each([&](flecs::entity e, WorldTransform& t, MeshComponent& meshComp, AnimatorComponent& anim) {
-                if (!meshComp.mesh || !anim.skeleton) return;
-                
-                struct SceneUBO {
-                    glm::mat4 model;
-                    glm::mat4 view;
-                    glm::mat4 proj;
-                } sceneUbo;
-                
-                // Apply render offset
-                glm::mat4 model = t.matrix;
-                if (meshComp.renderOffset != glm::vec3(0.0f)) {
-                    model = glm::translate(model, meshComp.renderOffset);
-                }
-                sceneUbo.model = model;
-                sceneUbo.view = view;
-                sceneUbo.proj = proj;
+        for (size_t i = 0; i < snapshot.skinned.size(); ++i) {
+            if (!m_CameraView.skinnedVisible[i]) continue;
+            const SkinnedInstance& instance = snapshot.skinned[i];
 
-                SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &sceneUbo, sizeof(sceneUbo));
+            struct SceneUBO {
+                glm::mat4 model;
+                glm::mat4 view;
+                glm::mat4 proj;
+            } sceneUbo;
+            
+            sceneUbo.model = instance.model;
+            sceneUbo.view = view;
+            sceneUbo.proj = proj;
 
-                // Push Skin UBO (256 matrices)
-                std::vector<glm::mat4> skinMatrices(256, glm::mat4(1.0f));
-                auto it = skinData.find(e.id());
-                if (it != skinData.end()) {
-                    skinMatrices = it->second;
-                }
-                SDL_PushGPUVertexUniformData(m_RenderDevice.GetCommandBuffer(), 1, skinMatrices.data(), 256 * sizeof(glm::mat4));
-                
-                // Push Light UBO
-                SDL_PushGPUFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, lightUbo, lightUboSize);
-                
-                // Bind shadow map sampler (set 2, binding 0)
-                SDL_GPUTextureSamplerBinding shadowBinding;
-                shadowBinding.texture = m_RenderDevice.GetShadowMapTexture();
-                shadowBinding.sampler = m_RenderDevice.GetShadowSampler();
-                SDL_BindGPUFragmentSamplers(pass, 0, &shadowBinding, 1);
-                
-                // Bind buffers
-                SDL_GPUBufferBinding vertexBinding;
-                vertexBinding.buffer = meshComp.mesh->GetVertexBuffer();
-                vertexBinding.offset = 0;
-                
-                SDL_GPUBufferBinding indexBinding;
-                indexBinding.buffer = meshComp.mesh->GetIndexBuffer();
-                indexBinding.offset = 0;
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 0, &sceneUbo, sizeof(sceneUbo));
 
-                SDL_BindGPUVertexBuffers(pass, 0, &vertexBinding, 1);
-                SDL_BindGPUIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
-                
-                Uint32 indexCount = meshComp.mesh->GetIndexCount();
-                SDL_DrawGPUIndexedPrimitives(pass, indexCount, 1, 0, 0, 0);
-                
-                m_Stats.drawCalls++;
-            });
+            // Push Skin UBO (256 matrices)
+            m_RenderDevice.PushVertexUniformData(m_RenderDevice.GetCommandBuffer(), 1, FillSkinBlock(snapshot, instance), RenderSnapshot::MaxSkinJoints * sizeof(glm::mat4));
+            
+            // Push Light UBO
+            m_RenderDevice.PushFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, lightUbo, lightUboSize);
+            
+            // Bind shadow map sampler (set 2, binding 0)
+            SDL_GPUTextureSamplerBinding shadowBinding;
+            shadowBinding.texture = m_RenderDevice.GetShadowMapTexture();
+            shadowBinding.sampler = m_RenderDevice.GetShadowSampler();
+            m_RenderDevice.BindFragmentSamplers(pass, 0, &shadowBinding, 1);
+            
+            // Bind buffers
+            SDL_GPUBufferBinding vertexBinding;
+            vertexBinding.buffer = instance.mesh->GetVertexBuffer();
+            vertexBinding.offset = 0;
+            
+            SDL_GPUBufferBinding indexBinding;
+            indexBinding.buffer = instance.mesh->GetIndexBuffer();
+            indexBinding.offset = 0;
+
+            m_RenderDevice.BindVertexBuffers(pass, 0, &vertexBinding, 1);
+            m_RenderDevice.BindIndexBuffer(pass, &indexBinding, SDL_GPU_INDEXELEMENTSIZE_32BIT);
+            
+            Uint32 indexCount = instance.mesh->GetIndexCount();
+            m_RenderDevice.DrawIndexedPrimitives(pass, indexCount, 1, 0, 0, 0);
+            
+            m_Stats.drawCalls++;
+        }
     }
 
     void RenderSystem::RenderBloomPass() {
+        PROFILE_SCOPE("Render::Bloom");
         // Check if bloom is enabled and we have all required resources
         if (!m_RenderDevice.IsBloomEnabled() || !m_RenderDevice.IsHDREnabled()) {
             return;
@@ -2641,21 +2867,21 @@ namespace Systems {
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             colorTarget.clear_color = {0, 0, 0, 1};
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
             SDL_GPUViewport viewport = {};
             viewport.w = static_cast<float>(bloomWidth);
             viewport.h = static_cast<float>(bloomHeight);
             viewport.max_depth = 1.0f;
-            SDL_SetGPUViewport(pass, &viewport);
+            m_RenderDevice.SetViewport(pass, &viewport);
             
-            SDL_BindGPUGraphicsPipeline(pass, m_BloomBrightPassPipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_BloomBrightPassPipeline);
             
             SDL_GPUTextureSamplerBinding texBinding = {};
             texBinding.texture = hdrTexture;
             texBinding.sampler = m_LinearSampler;
-            SDL_BindGPUFragmentSamplers(pass, 0, &texBinding, 1);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, &texBinding, 1);
             
             struct BrightPassParams {
                 float threshold;
@@ -2675,10 +2901,10 @@ namespace Systems {
                 lastThreshold = params.threshold;
             }
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
             m_Stats.drawCalls++;
         }
         
@@ -2697,21 +2923,21 @@ namespace Systems {
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             colorTarget.clear_color = {0, 0, 0, 1};
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
             SDL_GPUViewport viewport = {};
             viewport.w = static_cast<float>(bloomWidth);
             viewport.h = static_cast<float>(bloomHeight);
             viewport.max_depth = 1.0f;
-            SDL_SetGPUViewport(pass, &viewport);
+            m_RenderDevice.SetViewport(pass, &viewport);
             
-            SDL_BindGPUGraphicsPipeline(pass, m_BloomBlurPipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_BloomBlurPipeline);
             
             SDL_GPUTextureSamplerBinding texBinding = {};
             texBinding.texture = readTexture;
             texBinding.sampler = m_LinearSampler;
-            SDL_BindGPUFragmentSamplers(pass, 0, &texBinding, 1);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, &texBinding, 1);
             
             struct BlurParams {
                 float dirX, dirY;
@@ -2725,10 +2951,10 @@ namespace Systems {
             params.texelSizeX = texelWidth;
             params.texelSizeY = texelHeight;
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
             m_Stats.drawCalls++;
             
             // Swap read/write textures (ping-pong)
@@ -2754,6 +2980,7 @@ namespace Systems {
     }
 
     void RenderSystem::RenderToneMappingPass() {
+        PROFILE_SCOPE("Render::ToneMapping");
         if (!m_ToneMappingPipeline || !m_RenderDevice.IsHDREnabled()) {
             return;
         }
@@ -2790,10 +3017,10 @@ namespace Systems {
         viewport.h = static_cast<float>(m_RenderDevice.GetRenderHeight());
         viewport.min_depth = 0.0f;
         viewport.max_depth = 1.0f;
-        SDL_SetGPUViewport(pass, &viewport);
+        m_RenderDevice.SetViewport(pass, &viewport);
         
         // Bind the tone mapping pipeline
-        SDL_BindGPUGraphicsPipeline(pass, m_ToneMappingPipeline);
+        m_RenderDevice.BindGraphicsPipeline(pass, m_ToneMappingPipeline);
         
         // Bind HDR texture and bloom texture as samplers
         SDL_GPUTextureSamplerBinding texBindings[2] = {};
@@ -2804,7 +3031,7 @@ namespace Systems {
         texBindings[1].texture = m_BloomResultTexture ? m_BloomResultTexture : hdrTexture;
         texBindings[1].sampler = m_LinearSampler;
         
-        SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 2);
+        m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 2);
         
         // Push tone mapping parameters
         struct ToneMappingParams {
@@ -2828,10 +3055,10 @@ namespace Systems {
             lastIntensity = params.bloomIntensity;
         }
         
-        SDL_PushGPUFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, &params, sizeof(params));
+        m_RenderDevice.PushFragmentUniformData(m_RenderDevice.GetCommandBuffer(), 0, &params, sizeof(params));
         
         // Draw fullscreen triangle (3 vertices, generated in shader)
-        SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+        m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
         
         m_Stats.drawCalls++;
         
@@ -2840,6 +3067,7 @@ namespace Systems {
     }
 
     void RenderSystem::RenderSSGIPass(const glm::mat4& view, const glm::mat4& proj) {
+        PROFILE_SCOPE("Render::SSGI");
         if (!m_SSGIPipeline || !m_RenderDevice.IsSSGIEnabled()) return;
         
         SDL_GPUTexture* ssgiTexture = m_RenderDevice.GetSSGITexture();
@@ -2880,10 +3108,10 @@ namespace Systems {
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             colorTarget.clear_color = { 0.0f, 0.0f, 0.0f, 0.0f };
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
-            SDL_BindGPUGraphicsPipeline(pass, m_SSGIPipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_SSGIPipeline);
             
             // Bind samplers: color, depth, normal (using depth to reconstruct), noise
             SDL_GPUTextureSamplerBinding texBindings[4] = {};
@@ -2896,7 +3124,7 @@ namespace Systems {
             texBindings[3].texture = noiseTexture ? noiseTexture : depthTexture;  // Fallback if no noise
             texBindings[3].sampler = m_Sampler;  // Nearest for noise
             
-            SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 4);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 4);
             
             // SSGI parameters
             struct SSGIParams {
@@ -2940,12 +3168,12 @@ namespace Systems {
             params.thickness = 0.1f;
             params.frameIndex = static_cast<float>(m_FrameIndex);
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &params, sizeof(params));
             
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             m_Stats.drawCalls++;
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
         }
         
         // ========== Pass 2: Temporal Accumulation ==========
@@ -2955,10 +3183,10 @@ namespace Systems {
             colorTarget.load_op = SDL_GPU_LOADOP_DONT_CARE;
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
-            SDL_BindGPUGraphicsPipeline(pass, m_SSGITemporalPipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_SSGITemporalPipeline);
             
             SDL_GPUTextureSamplerBinding texBindings[4] = {};
             texBindings[0].texture = ssgiTexture;        // Current GI
@@ -2970,7 +3198,7 @@ namespace Systems {
             texBindings[3].texture = depthTexture;       // Velocity (placeholder)
             texBindings[3].sampler = m_LinearSampler;
             
-            SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 4);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 4);
             
             struct TemporalParams {
                 glm::mat4 viewMatrix;
@@ -3003,12 +3231,12 @@ namespace Systems {
             tParams.normalThreshold = 0.95f;
             tParams.useVelocity = 0;
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &tParams, sizeof(tParams));
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &tParams, sizeof(tParams));
             
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             m_Stats.drawCalls++;
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
         }
         
         // ========== Pass 3: Spatial Denoising (Horizontal) ==========
@@ -3018,10 +3246,10 @@ namespace Systems {
             colorTarget.load_op = SDL_GPU_LOADOP_DONT_CARE;
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
-            SDL_BindGPUGraphicsPipeline(pass, m_SSGIDenoisePipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_SSGIDenoisePipeline);
             
             SDL_GPUTextureSamplerBinding texBindings[3] = {};
             texBindings[0].texture = ssgiDenoiseTexture;  // Read from temporal output
@@ -3031,7 +3259,7 @@ namespace Systems {
             texBindings[2].texture = depthTexture;
             texBindings[2].sampler = m_LinearSampler;
             
-            SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 3);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 3);
             
             struct DenoiseParams {
                 glm::vec4 screenSize;
@@ -3057,12 +3285,12 @@ namespace Systems {
             dParams.kernelRadius = 4;     // Larger kernel for better denoising
             dParams.passIndex = 0;  // Horizontal
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &dParams, sizeof(dParams));
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &dParams, sizeof(dParams));
             
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             m_Stats.drawCalls++;
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
         }
         
         // ========== Pass 4: Spatial Denoising (Vertical) ==========
@@ -3072,10 +3300,10 @@ namespace Systems {
             colorTarget.load_op = SDL_GPU_LOADOP_DONT_CARE;
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
-            SDL_BindGPUGraphicsPipeline(pass, m_SSGIDenoisePipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_SSGIDenoisePipeline);
             
             SDL_GPUTextureSamplerBinding texBindings[3] = {};
             texBindings[0].texture = ssgiTexture;  // Read from horizontal pass
@@ -3085,7 +3313,7 @@ namespace Systems {
             texBindings[2].texture = depthTexture;
             texBindings[2].sampler = m_LinearSampler;
             
-            SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 3);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 3);
             
             struct DenoiseParams {
                 glm::vec4 screenSize;
@@ -3111,12 +3339,12 @@ namespace Systems {
             dParams.kernelRadius = 4;     // Larger kernel for better denoising
             dParams.passIndex = 1;  // Vertical
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &dParams, sizeof(dParams));
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &dParams, sizeof(dParams));
             
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             m_Stats.drawCalls++;
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
         }
         
         // ========== Pass 5: Composite GI with Scene ==========
@@ -3128,10 +3356,10 @@ namespace Systems {
             colorTarget.load_op = SDL_GPU_LOADOP_LOAD;  // Preserve existing content
             colorTarget.store_op = SDL_GPU_STOREOP_STORE;
             
-            SDL_GPURenderPass* pass = SDL_BeginGPURenderPass(cmdBuffer, &colorTarget, 1, nullptr);
+            SDL_GPURenderPass* pass = m_RenderDevice.BeginRenderPass(cmdBuffer, &colorTarget, 1, nullptr);
             if (!pass) return;
             
-            SDL_BindGPUGraphicsPipeline(pass, m_SSGICompositePipeline);
+            m_RenderDevice.BindGraphicsPipeline(pass, m_SSGICompositePipeline);
             
             // Only sample from SSGI result - the scene is loaded via LOAD_OP
             SDL_GPUTextureSamplerBinding texBindings[2] = {};
@@ -3140,7 +3368,7 @@ namespace Systems {
             texBindings[1].texture = ssgiDenoiseTexture; // Duplicate for padding (we use 2 in pipeline but only need 1)
             texBindings[1].sampler = m_LinearSampler;
             
-            SDL_BindGPUFragmentSamplers(pass, 0, texBindings, 2);
+            m_RenderDevice.BindFragmentSamplers(pass, 0, texBindings, 2);
             
             struct CompositeParams {
                 float giIntensity;
@@ -3153,12 +3381,12 @@ namespace Systems {
             cParams.aoStrength = 0.0f;
             cParams.debugMode = m_RenderDevice.GetSSGIDebugMode();
             
-            SDL_PushGPUFragmentUniformData(cmdBuffer, 0, &cParams, sizeof(cParams));
+            m_RenderDevice.PushFragmentUniformData(cmdBuffer, 0, &cParams, sizeof(cParams));
             
-            SDL_DrawGPUPrimitives(pass, 3, 1, 0, 0);
+            m_RenderDevice.DrawPrimitives(pass, 3, 1, 0, 0);
             m_Stats.drawCalls++;
             
-            SDL_EndGPURenderPass(pass);
+            m_RenderDevice.EndRenderPass(pass);
         }
         
         // Copy current SSGI result to history buffer for next frame's temporal pass
@@ -3174,7 +3402,7 @@ namespace Systems {
             blitInfo.load_op = SDL_GPU_LOADOP_DONT_CARE;
             blitInfo.filter = SDL_GPU_FILTER_LINEAR;
             
-            SDL_BlitGPUTexture(cmdBuffer, &blitInfo);
+            m_RenderDevice.BlitTexture(cmdBuffer, &blitInfo);
         }
         
         // Update matrices for next frame
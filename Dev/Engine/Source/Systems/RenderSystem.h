@@ -3,13 +3,16 @@
 #include "../Core/Context.h"
 #include "../Platform/RenderDevice.h"
 #include "../Resources/ResourceManager.h"
+#include "FrustumCulling.h"
 #include <SDL3/SDL.h>
+#include <atomic>
 #include <vector>
 #include <unordered_map>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
-namespace Resources { class Mesh; }
+namespace Resources { class Mesh; class Texture; }
+struct AnimatorComponent;
 
 namespace Systems {
 
@@ -24,11 +27,88 @@ namespace Systems {
         glm::vec4 color;
     };
 
-    // Batch of instances sharing the same mesh (static meshes only)
+    // Static instances sharing the same mesh: a contiguous range of slots in the shared instance buffer.
+    // Slots persist between frames, so an instance is only uploaded again when it changes.
     struct MeshBatch {
         std::shared_ptr<Resources::Mesh> mesh;
-        std::vector<MeshInstance> instances;
-        uint32_t instanceOffset = 0;  // Offset into shared instance buffer
+        uint32_t instanceOffset = 0;
+        uint32_t instanceCount = 0;
+    };
+
+    // Consecutive instance slots, as sent with a snapshot
+    struct InstanceRange {
+        uint32_t firstSlot = 0;
+        uint32_t count = 0;
+    };
+
+    struct PointLightInstance {
+        glm::vec3 position;
+        float radius;
+        glm::vec3 color;
+        float intensity;
+        uint64_t entityId;
+    };
+
+    struct SpriteInstance {
+        glm::mat4 model;
+        std::shared_ptr<Resources::Texture> texture;
+    };
+
+    struct SkinnedInstance {
+        static constexpr uint32_t NoPalette = 0xFFFFFFFF;
+
+        std::shared_ptr<Resources::Mesh> mesh;
+        glm::mat4 model;
+        uint32_t paletteOffset = NoPalette; // Into RenderSnapshot::skinPalettes; NoPalette until the animator has a pose
+        uint32_t jointCount = 1;            // Matrices the mesh's vertices index, the length of its palette
+    };
+
+    // Everything a frame needs from the world, copied out once the simulation is done with it.
+    // Recording a frame only reads the snapshot, so the world can move on to the next tick meanwhile.
+    // Every pass walks these flat arrays; the world is traversed once, by RenderSystem::Extract.
+    struct RenderSnapshot {
+        static constexpr uint32_t MaxSkinJoints = 256;   // Largest palette, the size of the skin uniform block
+        static constexpr uint32_t MaxNearestLights = 8;  // Point lights the classic forward path shades
+
+        double alpha = 0.0;       // Interpolation factor the transforms were extracted with
+        uint64_t extractedAt = 0; // SDL_GetTicksNS() when the snapshot was taken
+
+        // Primary camera. The projection is built when recording since it depends on the swapchain size.
+        bool hasCamera = false;
+        glm::mat4 view = glm::mat4(1.0f);
+        glm::vec3 cameraPosition = glm::vec3(0, 2, 5);
+        glm::vec3 shadowFocus = glm::vec3(0.0f); // Where the camera looks, the shadow frustum is centred there
+        float fov = 45.0f;
+        float nearPlane = 0.1f;
+        float farPlane = 100.0f;
+
+        // Directional light (defaults are used when the scene has none)
+        glm::vec3 lightDirection = glm::vec3(-0.5f, -1.0f, -0.3f);
+        float lightIntensity = 1.0f;
+        glm::vec3 lightColor = glm::vec3(1.0f, 0.95f, 0.9f);
+        glm::vec3 ambientColor = glm::vec3(0.15f, 0.15f, 0.2f);
+        glm::mat4 lightSpaceMatrix = glm::mat4(1.0f); // Shadow map projection, centred on shadowFocus
+
+        std::vector<PointLightInstance> pointLights;  // Sorted by entity id so the order is stable between frames
+        uint32_t nearestLights[MaxNearestLights];     // Indices into pointLights, closest to the camera first
+        uint32_t nearestLightCount = 0;
+
+        std::vector<SpriteInstance> sprites;
+        std::vector<MeshBatch> batches;               // Every static batch and the slots it uses
+        uint32_t instanceSlots = 0;                   // Slots the batches span
+        std::vector<InstanceRange> instanceUpdates;   // Slots whose instance changed since the previous snapshot
+        std::vector<MeshInstance> instances;          // Their new values, the ranges back to back
+        CullBounds instanceBounds;                    // World box per entry of `instances`
+        uint64_t instanceSerial = 0;                  // Counts snapshots, so the renderer notices one it never drew
+        bool fullInstanceUpdate = false;              // `instanceUpdates` covers every slot in use
+        std::vector<SkinnedInstance> skinned;
+        CullBounds skinnedBounds;                     // World box per skinned instance
+        std::vector<glm::mat4> skinPalettes;          // Every posed instance's palette back to back, jointCount matrices each
+        std::vector<LineVertex> lines;
+
+        uint32_t totalInstances = 0;
+
+        void Clear();
     };
 
     // Render statistics
@@ -36,15 +116,23 @@ namespace Systems {
         uint32_t drawCalls = 0;
         uint32_t totalInstances = 0;
         uint32_t batchedInstances = 0;
+        uint32_t updatedInstances = 0;      // Static instances uploaded this frame
         uint32_t skinnedInstances = 0;
         uint32_t lineVertices = 0;
+        uint32_t pointLights = 0;
+        uint32_t culledInstances = 0;       // Outside the camera frustum (the depth pre-pass draws the same set)
+        uint32_t shadowCulledInstances = 0; // Outside the shadow map's frustum
         
         void Reset() {
             drawCalls = 0;
             totalInstances = 0;
             batchedInstances = 0;
+            updatedInstances = 0;
             skinnedInstances = 0;
             lineVertices = 0;
+            pointLights = 0;
+            culledInstances = 0;
+            shadowCulledInstances = 0;
         }
     };
 
@@ -54,8 +142,14 @@ namespace Systems {
         ~RenderSystem();
         
         void Init();
-        void BeginFrame(bool drawSkeleton = true);
-        void DrawScene(double alpha);
+
+        // Copies what the next frame needs out of the world into `snapshot`. Only touches the world
+        // and the snapshot, so it can run on whichever thread ran the simulation.
+        // Transforms are blended between the last two fixed ticks by `alpha` (0 = previous, 1 = current).
+        void Extract(RenderSnapshot& snapshot, double alpha, bool drawSkeleton, bool drawColliders);
+
+        void BeginFrame();
+        void DrawScene(const RenderSnapshot& snapshot);
         void EndFrame();      // Runs bloom + tone mapping, leaves render pass open for UI
         void FinishFrame();   // Ends render pass and submits command buffer
 
@@ -65,7 +159,6 @@ namespace Systems {
         void DrawWireBox(const glm::vec3& center, const glm::vec3& halfExtents, const glm::vec3& color, const glm::quat& rotation = glm::quat(1,0,0,0));
         void DrawWireSphere(const glm::vec3& center, float radius, const glm::vec3& color, int segments = 16);
         void DrawWireCapsule(const glm::vec3& center, float halfHeight, float radius, const glm::vec3& color, int segments = 12);
-        void DrawPhysicsDebug(); // Draw all colliders in the scene
         
         // Render statistics
         const RenderStats& GetStats() const { return m_Stats; }
@@ -86,16 +179,78 @@ namespace Systems {
         SDL_GPUSampler* m_Sampler = nullptr;
         SDL_GPUSampler* m_LinearSampler = nullptr;  // For HDR texture sampling
         
-        std::vector<LineVertex> m_LineVertices;
-        std::vector<SDL_GPUBuffer*> m_BuffersToDelete;
-        std::vector<SDL_GPUTransferBuffer*> m_TransferBuffersToDelete;
-        SDL_GPUBuffer* m_CurrentLineBuffer = nullptr;
+        std::vector<LineVertex> m_LineVertices;  // Debug lines gathered for the next snapshot
+        std::vector<SDL_GPUBuffer*> m_BuffersToDelete;  // Replaced buffers, released next frame
+        SDL_GPUBuffer* m_LineBuffer = nullptr;
+        uint32_t m_LineBufferCapacity = 0;              // In vertices
         SDL_GPUBuffer* m_DefaultSkinBuffer = nullptr;
+
+        // The skin uniform block both skinned passes push: an instance's palette, identity past it
+        std::vector<glm::mat4> m_SkinBlock;
+        uint32_t m_SkinBlockUsed = 0;           // Leading matrices that aren't identity
+
+        // Static batches as extraction last saw them. Each keeps its instances in slot order with the
+        // entity owning each slot, so unchanged instances are skipped and only changes are sent.
+        // Only touched by Extract.
+        struct StaticBatch {
+            std::shared_ptr<Resources::Mesh> mesh;
+            uint32_t firstSlot = 0;
+            uint32_t capacity = 0;
+            std::vector<MeshInstance> instances;
+            std::vector<uint64_t> entities;
+            std::vector<uint64_t> seen;    // m_ExtractSerial when each slot's entity was last visited
+            std::vector<uint8_t> dirty;
+            uint32_t dirtyCount = 0;
+        };
+        struct EntitySlot {
+            static constexpr uint32_t None = 0xFFFFFFFF;
+            uint32_t batch = None;
+            uint32_t index = 0;
+        };
+        std::vector<StaticBatch> m_StaticBatches;
+        std::unordered_map<Resources::Mesh*, uint32_t> m_BatchLookup;
+        std::vector<EntitySlot> m_EntitySlots;   // By entity index (the low 32 bits of the id)
+        uint32_t m_StaticSlotCount = 0;          // Slots the batch ranges span
+        uint32_t m_OccupiedSlots = 0;
+        uint64_t m_ExtractSerial = 0;
+        std::atomic<bool> m_NeedFullInstanceUpdate{true}; // Set when the renderer missed a snapshot's changes
+
+        void RemoveStaticSlot(uint32_t batch, uint32_t index);
+        void LayoutStaticBatches();
+        void WriteInstanceUpdates(RenderSnapshot& snapshot, bool full);
+
+        // Extraction scratch, reused every frame
+        struct PosedInstanceRef {
+            const AnimatorComponent* animator;
+            uint32_t instance; // Into RenderSnapshot::skinned
+        };
+        std::vector<PosedInstanceRef> m_PosedScratch;
+        std::vector<uint32_t> m_LightOrderScratch;
+
+        // What one view draws after frustum culling: a range of m_ViewInstanceBuffer per snapshot batch
+        // (empty when nothing of it is visible), filled on the GPU by copying runs of visible slots
+        struct SlotCopy {
+            uint32_t firstSlot;
+            uint32_t offset; // Into m_ViewInstanceBuffer
+            uint32_t count;
+        };
+        struct CulledView {
+            std::vector<MeshBatch> batches;
+            std::vector<SlotCopy> copies;
+            std::vector<uint8_t> visible;        // Per slot
+            std::vector<uint8_t> skinnedVisible; // Per RenderSnapshot::skinned entry
+            uint32_t culled = 0;                 // Static and skinned
+        };
+        CulledView m_CameraView;  // Main pass and depth pre-pass
+        CulledView m_ShadowView;
+        CullBounds m_SlotBounds;  // World box per instance slot, kept up to date from the snapshots
+        uint64_t m_AppliedInstanceSerial = 0;
         
         // Batch rendering
-        std::unordered_map<Resources::Mesh*, MeshBatch> m_Batches;
-        SDL_GPUBuffer* m_InstanceBuffer = nullptr;
-        uint32_t m_InstanceBufferCapacity = 0;
+        SDL_GPUBuffer* m_InstanceBuffer = nullptr;      // Persistent slots
+        uint32_t m_InstanceBufferCapacity = 0;          // In slots
+        SDL_GPUBuffer* m_ViewInstanceBuffer = nullptr;  // Every view's visible instances, what the passes draw
+        uint32_t m_ViewInstanceBufferCapacity = 0;
         RenderStats m_Stats;
 
         void CreatePipeline();
@@ -109,15 +264,21 @@ namespace Systems {
         void CreateSSGIPipelines();
         
         void RenderToneMappingPass();  // Tone map HDR -> Swapchain
-        void RenderDepthPrePass(const glm::mat4& view, const glm::mat4& proj);  // Depth pre-pass for Forward+
-        void RenderShadowPass(const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData);  // Render shadow map from light's perspective
+        void RenderDepthPrePass(const RenderSnapshot& snapshot, const glm::mat4& view, const glm::mat4& proj);  // Depth pre-pass for Forward+
+        void RenderShadowPass(const RenderSnapshot& snapshot);  // Render shadow map from light's perspective
         void DispatchLightCulling(const glm::mat4& view, const glm::mat4& proj);  // Light culling compute
-        void UpdateLightBufferForForwardPlus();  // Update GPU light buffer for Forward+ culling
+        void UpdateLightBufferForForwardPlus(const RenderSnapshot& snapshot);  // Update GPU light buffer for Forward+ culling
         
-        void BuildBatches();
-        void RenderBatches(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, const void* lightUbo, size_t lightUboSize);
-        void RenderSkinnedMeshes(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, const void* lightUbo, size_t lightUboSize,
-                                  const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData);
+        void ExtractMeshes(RenderSnapshot& snapshot, bool drawSkeleton);
+        void ExtractLights(RenderSnapshot& snapshot);
+        void ExtractPhysicsDebug(); // Collider wireframes into m_LineVertices
+        void ApplyInstanceUpdates(const RenderSnapshot& snapshot);
+        // Culls the slots and skinned instances against viewProj and places the view's batches at
+        // `offset` in m_ViewInstanceBuffer, which is advanced past them
+        void CullView(const RenderSnapshot& snapshot, const glm::mat4& viewProj, CulledView& view, uint32_t& offset);
+        void UploadInstances(const RenderSnapshot& snapshot, uint32_t viewInstances);
+        void RenderBatches(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, const void* lightUbo, size_t lightUboSize);
+        void RenderSkinnedMeshes(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj, const void* lightUbo, size_t lightUboSize);
         
         // Forward+ pipelines
         SDL_GPUGraphicsPipeline* m_DepthOnlyPipeline = nullptr;
@@ -130,7 +291,9 @@ namespace Systems {
         SDL_GPUGraphicsPipeline* m_ShadowMapSkinnedPipeline = nullptr;  // For skinned meshes
         glm::mat4 m_LightSpaceMatrix = glm::mat4(1.0f);  // Cached for fragment shader
         void CreateShadowMapSkinnedPipeline();
-        void RenderSkinnedMeshesToShadowMap(SDL_GPURenderPass* pass, const std::unordered_map<uint64_t, std::vector<glm::mat4>>& skinData);
+        void RenderSkinnedMeshesToShadowMap(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass);
+        // Copies the instance's palette into m_SkinBlock, ready to push whole
+        const glm::mat4* FillSkinBlock(const RenderSnapshot& snapshot, const SkinnedInstance& instance);
         
         // Bloom pipelines
         SDL_GPUGraphicsPipeline* m_BloomBrightPassPipeline = nullptr;
@@ -144,7 +307,7 @@ namespace Systems {
         
         // Forward+ rendering method
         void CreateForwardPlusPipeline();
-        void RenderBatchesForwardPlus(SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj);
+        void RenderBatchesForwardPlus(const RenderSnapshot& snapshot, SDL_GPURenderPass* pass, const glm::mat4& view, const glm::mat4& proj);
         
         // Bloom rendering methods
         void CreateBloomPipelines();
@@ -1,7 +1,6 @@
 #include "ScriptSystem.h"
 #include "../Components/Components.h"
 #include <flecs.h>
-#include <iostream>
 
 namespace Systems {
 
@@ -0,0 +1,96 @@
+#include "TransformBatch.h"
+#include "TransformBatchKernel.h"
+#include "../Components/Components.h"
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/type_ptr.hpp>
+#include <cstddef>
+
+#if OAKEN_TRANSFORM_SIMD && defined(_MSC_VER)
+    #include <intrin.h>
+#endif
+
+namespace Systems {
+    // The kernels read and write these as plain floats
+    static_assert(sizeof(LocalTransform) == TransformKernel::LocalFloats * sizeof(float), "LocalTransform must be 10 packed floats");
+    static_assert(offsetof(LocalTransform, rotation) == 3 * sizeof(float) && offsetof(LocalTransform, scale) == 7 * sizeof(float),
+        "LocalTransform must be position, rotation, scale");
+    static_assert(offsetof(glm::quat, x) == 0 && offsetof(glm::quat, w) == 3 * sizeof(float), "The kernels expect quaternions stored as x y z w");
+    static_assert(sizeof(WorldTransform) == TransformKernel::MatrixFloats * sizeof(float), "WorldTransform must be a packed mat4");
+
+    namespace {
+        bool CpuHasAVX2() {
+#if OAKEN_TRANSFORM_SIMD && defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 1);
+            bool fma = (info[2] & (1 << 12)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            // The OS must save the YMM registers on context switches
+            if (!fma || !osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6) return false;
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#elif OAKEN_TRANSFORM_SIMD
+            return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+            return false;
+#endif
+        }
+    }
+
+    glm::mat4 TransformBatch::ComposeScalar(const LocalTransform& local) {
+        glm::mat4 model = glm::mat4(1.0f);
+        model = glm::translate(model, local.position);
+        model = model * glm::mat4_cast(local.rotation);
+        model = glm::scale(model, local.scale);
+        return model;
+    }
+
+    bool TransformBatch::IsSupported(Path path) {
+        switch (path) {
+            case Path::Scalar: return true;
+            case Path::SSE2: return OAKEN_TRANSFORM_SIMD != 0;
+            case Path::AVX2: {
+                static const bool supported = CpuHasAVX2();
+                return supported;
+            }
+        }
+        return false;
+    }
+
+    TransformBatch::Path TransformBatch::GetBestPath() {
+        static const Path best = IsSupported(Path::AVX2) ? Path::AVX2 : IsSupported(Path::SSE2) ? Path::SSE2 : Path::Scalar;
+        return best;
+    }
+
+    const char* TransformBatch::GetPathName(Path path) {
+        switch (path) {
+            case Path::Scalar: return "Scalar";
+            case Path::SSE2: return "SSE2";
+            case Path::AVX2: return "AVX2";
+        }
+        return "Unknown";
+    }
+
+    void TransformBatch::Compose(const LocalTransform* locals, WorldTransform* worlds, uint32_t count, const glm::mat4* parent) {
+        Compose(GetBestPath(), locals, worlds, count, parent);
+    }
+
+    void TransformBatch::Compose(Path path, const LocalTransform* locals, WorldTransform* worlds, uint32_t count, const glm::mat4* parent) {
+#if OAKEN_TRANSFORM_SIMD
+        const float* in = reinterpret_cast<const float*>(locals);
+        float* out = reinterpret_cast<float*>(worlds);
+        const float* parentFloats = parent ? glm::value_ptr(*parent) : nullptr;
+        if (path == Path::AVX2 && IsSupported(Path::AVX2)) {
+            TransformKernel::ComposeAVX2(in, out, count, parentFloats);
+            return;
+        }
+        if (path != Path::Scalar) {
+            TransformKernel::Compose<TransformKernel::SSE2>(in, out, count, parentFloats);
+            return;
+        }
+#endif
+        for (uint32_t i = 0; i < count; ++i) {
+            worlds[i].matrix = parent ? *parent * ComposeScalar(locals[i]) : ComposeScalar(locals[i]);
+        }
+    }
+}
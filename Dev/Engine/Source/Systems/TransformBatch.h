@@ -0,0 +1,26 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cstdint>
+
+struct LocalTransform;
+struct WorldTransform;
+
+namespace Systems {
+    // Local-to-world matrices for runs of transforms (a table column), as T * R * S.
+    // The SIMD paths work on 4 (SSE2) or 8 (AVX2) transforms at a time; the best one the CPU
+    // supports is picked once. The scalar glm path is the reference they are checked against.
+    class TransformBatch {
+    public:
+        enum class Path { Scalar, SSE2, AVX2 };
+
+        // worlds[i] = local(locals[i]), or parent * local(locals[i]) when parent is set
+        static void Compose(const LocalTransform* locals, WorldTransform* worlds, uint32_t count, const glm::mat4* parent = nullptr);
+        static void Compose(Path path, const LocalTransform* locals, WorldTransform* worlds, uint32_t count, const glm::mat4* parent = nullptr);
+
+        static glm::mat4 ComposeScalar(const LocalTransform& local);
+
+        static Path GetBestPath();
+        static bool IsSupported(Path path);
+        static const char* GetPathName(Path path);
+    };
+}
@@ -0,0 +1,16 @@
+// The only translation unit built with AVX2 and FMA enabled; TransformBatch only calls into it
+// after checking the CPU.
+#include "TransformBatchKernel.h"
+
+#if OAKEN_TRANSFORM_SIMD
+namespace Systems::TransformKernel {
+    void ComposeAVX2(const float* locals, float* worlds, uint32_t count, const float* parent) {
+#ifdef __AVX2__
+        Compose<AVX2>(locals, worlds, count, parent);
+#else
+        // Compiler without the per-file AVX2 flag; still correct, just narrower
+        Compose<SSE2>(locals, worlds, count, parent);
+#endif
+    }
+}
+#endif
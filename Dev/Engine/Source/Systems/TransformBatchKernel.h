@@ -0,0 +1,185 @@
+#pragma once
+
+// Internal to TransformBatch: the SIMD kernel, written once against a small ops interface and
+// instantiated per instruction set (SSE2 in TransformBatch.cpp, AVX2 in TransformBatchAVX2.cpp,
+// which is the only file built with AVX2 enabled).
+//
+// Works on raw floats so it doesn't depend on glm's layout choices: a local transform is 10 floats
+// (position, rotation quaternion as x y z w, scale) and a matrix is 16 column-major floats.
+
+#include <cstdint>
+
+#if defined(_M_X64) || defined(__x86_64__)
+    #define OAKEN_TRANSFORM_SIMD 1
+    #include <immintrin.h>
+#else
+    #define OAKEN_TRANSFORM_SIMD 0
+#endif
+
+namespace Systems::TransformKernel {
+
+    constexpr uint32_t LocalFloats = 10;
+    constexpr uint32_t MatrixFloats = 16;
+
+#if OAKEN_TRANSFORM_SIMD
+
+    // Defined in TransformBatchAVX2.cpp. Only call when the CPU supports AVX2 and FMA.
+    void ComposeAVX2(const float* locals, float* worlds, uint32_t count, const float* parent);
+
+    // Internal linkage on purpose: each including file compiles its own copy with its own flags.
+    // Shared inline definitions would let the linker hand the SSE2 path the AVX2 file's encoding.
+    namespace {
+
+    struct SSE2 {
+        using F = __m128;
+        static constexpr uint32_t Width = 4;
+
+        static F Set(float v) { return _mm_set1_ps(v); }
+        static F Load(const float* p) { return _mm_load_ps(p); }
+        static void Store(float* p, F v) { _mm_store_ps(p, v); }
+        static F Add(F a, F b) { return _mm_add_ps(a, b); }
+        static F Sub(F a, F b) { return _mm_sub_ps(a, b); }
+        static F Mul(F a, F b) { return _mm_mul_ps(a, b); }
+        static F MulAdd(F a, F b, F c) { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+
+        // Writes the 4 floats {v0, v1, v2, v3}[lane] to dst + lane * stride for every lane
+        static void StoreTransposed(F v0, F v1, F v2, F v3, float* dst, uint32_t stride) {
+            _MM_TRANSPOSE4_PS(v0, v1, v2, v3);
+            _mm_storeu_ps(dst, v0);
+            _mm_storeu_ps(dst + stride, v1);
+            _mm_storeu_ps(dst + stride * 2, v2);
+            _mm_storeu_ps(dst + stride * 3, v3);
+        }
+    };
+
+#ifdef __AVX2__
+    struct AVX2 {
+        using F = __m256;
+        static constexpr uint32_t Width = 8;
+
+        static F Set(float v) { return _mm256_set1_ps(v); }
+        static F Load(const float* p) { return _mm256_load_ps(p); }
+        static void Store(float* p, F v) { _mm256_store_ps(p, v); }
+        static F Add(F a, F b) { return _mm256_add_ps(a, b); }
+        static F Sub(F a, F b) { return _mm256_sub_ps(a, b); }
+        static F Mul(F a, F b) { return _mm256_mul_ps(a, b); }
+        static F MulAdd(F a, F b, F c) { return _mm256_fmadd_ps(a, b, c); }
+
+        static void StoreTransposed(F v0, F v1, F v2, F v3, float* dst, uint32_t stride) {
+            SSE2::StoreTransposed(_mm256_castps256_ps128(v0), _mm256_castps256_ps128(v1),
+                _mm256_castps256_ps128(v2), _mm256_castps256_ps128(v3), dst, stride);
+            SSE2::StoreTransposed(_mm256_extractf128_ps(v0, 1), _mm256_extractf128_ps(v1, 1),
+                _mm256_extractf128_ps(v2, 1), _mm256_extractf128_ps(v3, 1), dst + stride * 4, stride);
+        }
+    };
+#endif
+
+    // Up to Ops::Width transforms: T * R * S, then parent * that when parent is set.
+    // Inputs are transposed through the stack; lanes past `count` compute an identity and aren't written.
+    template<typename Ops>
+    inline void ComposeBlock(const float* locals, float* worlds, uint32_t count, const float* parent) {
+        using F = typename Ops::F;
+        constexpr uint32_t W = Ops::Width;
+
+        alignas(32) float in[LocalFloats][W];
+        for (uint32_t lane = 0; lane < count; ++lane) {
+            for (uint32_t k = 0; k < LocalFloats; ++k) {
+                in[k][lane] = locals[LocalFloats * lane + k];
+            }
+        }
+        // Identity rotation (w = 1) and unit scale
+        for (uint32_t lane = count; lane < W; ++lane) {
+            for (uint32_t k = 0; k < LocalFloats; ++k) {
+                in[k][lane] = k >= 6 ? 1.0f : 0.0f;
+            }
+        }
+
+        F qx = Ops::Load(in[3]);
+        F qy = Ops::Load(in[4]);
+        F qz = Ops::Load(in[5]);
+        F qw = Ops::Load(in[6]);
+        F scaleX = Ops::Load(in[7]);
+        F scaleY = Ops::Load(in[8]);
+        F scaleZ = Ops::Load(in[9]);
+
+        F two = Ops::Set(2.0f);
+        F one = Ops::Set(1.0f);
+        F x2 = Ops::Mul(qx, two);
+        F y2 = Ops::Mul(qy, two);
+        F z2 = Ops::Mul(qz, two);
+        F xx = Ops::Mul(qx, x2);
+        F yy = Ops::Mul(qy, y2);
+        F zz = Ops::Mul(qz, z2);
+        F xy = Ops::Mul(qx, y2);
+        F xz = Ops::Mul(qx, z2);
+        F yz = Ops::Mul(qy, z2);
+        F wx = Ops::Mul(qw, x2);
+        F wy = Ops::Mul(qw, y2);
+        F wz = Ops::Mul(qw, z2);
+
+        // Columns of the rotation matrix, scaled per axis; m[column * 4 + row]
+        F m[MatrixFloats];
+        m[0] = Ops::Mul(Ops::Sub(one, Ops::Add(yy, zz)), scaleX);
+        m[1] = Ops::Mul(Ops::Add(xy, wz), scaleX);
+        m[2] = Ops::Mul(Ops::Sub(xz, wy), scaleX);
+        m[3] = Ops::Set(0.0f);
+        m[4] = Ops::Mul(Ops::Sub(xy, wz), scaleY);
+        m[5] = Ops::Mul(Ops::Sub(one, Ops::Add(xx, zz)), scaleY);
+        m[6] = Ops::Mul(Ops::Add(yz, wx), scaleY);
+        m[7] = Ops::Set(0.0f);
+        m[8] = Ops::Mul(Ops::Add(xz, wy), scaleZ);
+        m[9] = Ops::Mul(Ops::Sub(yz, wx), scaleZ);
+        m[10] = Ops::Mul(Ops::Sub(one, Ops::Add(xx, yy)), scaleZ);
+        m[11] = Ops::Set(0.0f);
+        m[12] = Ops::Load(in[0]);
+        m[13] = Ops::Load(in[1]);
+        m[14] = Ops::Load(in[2]);
+        m[15] = Ops::Set(1.0f);
+
+        if (parent) {
+            // world[c][r] = sum_k parent[k][r] * local[c][k]; the local matrix is affine. Summed in
+            // glm's order, translation last, so the SSE2 path matches the scalar one bit for bit.
+            F local[MatrixFloats];
+            for (uint32_t e = 0; e < MatrixFloats; ++e) {
+                local[e] = m[e];
+            }
+            for (uint32_t r = 0; r < 4; ++r) {
+                F p0 = Ops::Set(parent[r]);
+                F p1 = Ops::Set(parent[4 + r]);
+                F p2 = Ops::Set(parent[8 + r]);
+                for (uint32_t c = 0; c < 4; ++c) {
+                    F v = Ops::Mul(p0, local[c * 4 + 0]);
+                    v = Ops::MulAdd(p1, local[c * 4 + 1], v);
+                    v = Ops::MulAdd(p2, local[c * 4 + 2], v);
+                    m[c * 4 + r] = c == 3 ? Ops::Add(v, Ops::Set(parent[12 + r])) : v;
+                }
+            }
+        }
+
+        // A partial block goes through the stack so nothing past `count` is written
+        alignas(32) float partial[MatrixFloats * W];
+        float* dst = count == W ? worlds : partial;
+        for (uint32_t c = 0; c < 4; ++c) {
+            Ops::StoreTransposed(m[c * 4 + 0], m[c * 4 + 1], m[c * 4 + 2], m[c * 4 + 3], dst + c * 4, MatrixFloats);
+        }
+        if (count != W) {
+            for (uint32_t i = 0; i < MatrixFloats * count; ++i) {
+                worlds[i] = partial[i];
+            }
+        }
+    }
+
+    template<typename Ops>
+    inline void Compose(const float* locals, float* worlds, uint32_t count, const float* parent) {
+        constexpr uint32_t W = Ops::Width;
+        for (uint32_t begin = 0; begin < count; begin += W) {
+            uint32_t lanes = count - begin < W ? count - begin : W;
+            ComposeBlock<Ops>(locals + LocalFloats * begin, worlds + MatrixFloats * begin, lanes, parent);
+        }
+    }
+
+    }
+
+#endif
+
+}
@@ -1,30 +1,137 @@
 #include "TransformSystem.h"
+#include "TransformBatch.h"
 #include "../Components/Components.h"
+#include "../Core/JobSystem.h"
+#include "../Core/SystemScheduler.h"
 #include <flecs.h>
-#include <glm/gtc/matrix_transform.hpp>
+#include <algorithm>
 
 namespace Systems {
+    namespace {
+        // Rows per job when computing roots (a multiple of every SIMD width)
+        constexpr uint32_t RootRangeSize = 256;
+    }
+
     TransformSystem::TransformSystem(Core::GameContext& context) : m_Context(context) {}
 
     void TransformSystem::Init() {
-        m_Context.World->system<LocalTransform>("ComputeTransforms")
-            .kind(flecs::OnUpdate)
-            .each([](flecs::entity e, LocalTransform& local) {
-                glm::mat4 model = glm::mat4(1.0f);
-                model = glm::translate(model, local.position);
-                model = glm::rotate(model, glm::radians(local.rotation.x), glm::vec3(1, 0, 0));
-                model = glm::rotate(model, glm::radians(local.rotation.y), glm::vec3(0, 1, 0));
-                model = glm::rotate(model, glm::radians(local.rotation.z), glm::vec3(0, 0, 1));
-                model = glm::scale(model, local.scale);
-
-                // Handle Hierarchy
-                flecs::entity parent = e.parent();
-                if (parent && parent.has<WorldTransform>()) {
-                    const WorldTransform& parentWorld = parent.get<WorldTransform>();
-                    model = parentWorld.matrix * model;
+        flecs::world& world = *m_Context.World;
+
+        // All systems below have no phase: they are run by the SystemScheduler, not progress().
+        // WorldTransform is written in place, so the compute systems never touch the command queue.
+        //
+        // Only changed tables are recomputed (flecs change detection, per table): a table is dirty once
+        // its LocalTransform is set or iterated for writing, or its parent's WorldTransform was rewritten.
+        // Unchanged tables are skipped, which also keeps their WorldTransform clean for the children
+        // and for StorePreviousTransforms, so static geometry costs a version check per table.
+        // Systems that iterate LocalTransform for writing should skip() tables they leave untouched.
+
+        // Interpolation state follows the components it shadows, however they were added
+        world.component<WorldTransform>().add(flecs::With, world.component<PreviousWorldTransform>());
+        world.component<CameraComponent>().add(flecs::With, world.component<PreviousCameraTransform>());
+
+        m_PreviousTransforms = world.query_builder<const WorldTransform, PreviousWorldTransform>()
+            .cached()
+            .detect_changes()
+            .build();
+        m_PreviousCameras = world.query_builder<const LocalTransform, PreviousCameraTransform>()
+            .with<CameraComponent>()
+            .build();
+
+        // Give new LocalTransform entities a WorldTransform. Only matches entities that still need one.
+        m_AttachWorldTransforms = world.system<const LocalTransform>("AttachWorldTransforms")
+            .without<WorldTransform>()
+            .kind(0)
+            .each([](flecs::entity e, const LocalTransform&) {
+                e.add<WorldTransform>();
+            });
+
+        // Entities with no transformed ancestor. Change checks need one iterator per table, so they run
+        // here on one thread; the changed rows are independent and are then split across the job system.
+        m_ComputeTransforms = world.system<const LocalTransform, WorldTransform>("ComputeTransforms")
+            .without<WorldTransform>().parent()
+            .detect_changes()
+            .kind(0)
+            .run([this](flecs::iter& it) {
+                m_DirtyRoots.clear();
+                while (it.next()) {
+                    if (!it.changed()) {
+                        it.skip();
+                        continue;
+                    }
+                    auto locals = it.field<const LocalTransform>(0);
+                    auto worlds = it.field<WorldTransform>(1);
+                    uint32_t count = static_cast<uint32_t>(it.count());
+                    for (uint32_t begin = 0; begin < count; begin += RootRangeSize) {
+                        m_DirtyRoots.push_back({ &locals[begin], &worlds[begin], std::min(RootRangeSize, count - begin) });
+                    }
+                }
+
+                auto computeRanges = [this](uint32_t begin, uint32_t end) {
+                    for (uint32_t r = begin; r < end; ++r) {
+                        const RootRange& range = m_DirtyRoots[r];
+                        TransformBatch::Compose(range.locals, range.worlds, range.count);
+                    }
+                };
+
+                uint32_t rangeCount = static_cast<uint32_t>(m_DirtyRoots.size());
+                if (m_Context.Jobs && rangeCount > 1) {
+                    m_Context.Jobs->ParallelFor(rangeCount, 1, computeRanges);
+                } else {
+                    computeRanges(0, rangeCount);
                 }
+            });
 
-                e.set<WorldTransform>({model});
+        // Children, walked breadth-first (cascade) so a parent is always resolved before its children.
+        // A table holds the children of one parent, so the parent's matrix is shared by every row.
+        m_ComputeChildTransforms = world.system<const LocalTransform, WorldTransform, const WorldTransform>("ComputeChildTransforms")
+            .term_at(2).parent().cascade()
+            .detect_changes()
+            .kind(0)
+            .run([](flecs::iter& it) {
+                while (it.next()) {
+                    if (!it.changed()) {
+                        it.skip();
+                        continue;
+                    }
+                    auto locals = it.field<const LocalTransform>(0);
+                    auto worlds = it.field<WorldTransform>(1);
+                    const glm::mat4& parentWorld = it.field<const WorldTransform>(2)[0].matrix;
+                    TransformBatch::Compose(&locals[0], &worlds[0], static_cast<uint32_t>(it.count()), &parentWorld);
+                }
             });
     }
+
+    void TransformSystem::StorePreviousTransforms() {
+        // Entities whose WorldTransform hasn't been rewritten since the last call already match
+        m_PreviousTransforms.run([](flecs::iter& it) {
+            while (it.next()) {
+                if (!it.changed()) {
+                    it.skip();
+                    continue;
+                }
+                auto current = it.field<const WorldTransform>(0);
+                auto previous = it.field<PreviousWorldTransform>(1);
+                for (auto i : it) {
+                    previous[i].matrix = current[i].matrix;
+                    previous[i].valid = true;
+                }
+            }
+        });
+
+        m_PreviousCameras.each([](const LocalTransform& current, PreviousCameraTransform& previous) {
+            previous.position = current.position;
+            previous.rotation = current.rotation;
+            previous.valid = true;
+        });
+    }
+
+    void TransformSystem::Schedule(Core::SystemScheduler& scheduler) {
+        auto access = Core::SystemAccess().Read<LocalTransform>().Write<WorldTransform>();
+        // Adds a component, so it runs outside the readonly segment: the add then merges before
+        // the compute systems run, and an entity spawned this tick is transformed this tick
+        scheduler.AddSystem("AttachWorldTransforms", Core::SystemAccess(access).MakeExclusive(), m_AttachWorldTransforms);
+        scheduler.AddSystem("ComputeTransforms", access, m_ComputeTransforms);
+        scheduler.AddSystem("ComputeChildTransforms", access, m_ComputeChildTransforms);
+    }
 }
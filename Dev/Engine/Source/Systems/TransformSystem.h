@@ -1,13 +1,36 @@
 #pragma once
 #include "../Core/Context.h"
+#include "../Components/Components.h"
+#include <flecs.h>
+#include <vector>
+
+namespace Core { class SystemScheduler; }
 
 namespace Systems {
     class TransformSystem {
     public:
         TransformSystem(Core::GameContext& context);
         void Init();
+        void Schedule(Core::SystemScheduler& scheduler);
+
+        // Copies WorldTransform (and camera LocalTransform) into the Previous* components.
+        // Run right before the last fixed tick of a frame, so rendering can blend the two ticks.
+        void StorePreviousTransforms();
 
     private:
+        // Rows of one table whose roots need recomputing
+        struct RootRange {
+            const LocalTransform* locals;
+            WorldTransform* worlds;
+            uint32_t count;
+        };
+
         Core::GameContext& m_Context;
+        flecs::system m_AttachWorldTransforms;
+        flecs::system m_ComputeTransforms;      // Roots, changed rows split across the job system
+        flecs::system m_ComputeChildTransforms; // Hierarchy, cascade order
+        std::vector<RootRange> m_DirtyRoots;    // Scratch for ComputeTransforms, kept to reuse its capacity
+        flecs::query<const WorldTransform, PreviousWorldTransform> m_PreviousTransforms;
+        flecs::query<const LocalTransform, PreviousCameraTransform> m_PreviousCameras;
     };
 }
@@ -1,4 +1,6 @@
 #include "Engine.h"
+#include "Core/Log.h"
+#include "Scene/StressScene.h"
 #include <string>
 #include <iostream>
 #include <filesystem>
@@ -61,12 +63,59 @@ int main(int argc, char* argv[]) {
     // Parse args
     std::string gameDllPath = "Game.dll";
     double timeLimit = 0.0;
+    bool headless = false;
+    bool realtime = false;
+    bool nullGpu = false;
+    bool pipelined = false;
+    double tickRate = 0.0;
+    std::string perfLogPath;
+    std::string benchmarkPath;
+    std::string benchmarkOutPath;
+    std::string stressPath;
+    std::string stressOutPath;
 
     for (int i = 1; i < argc; ++i) {
         std::string arg = argv[i];
         if (arg == "--time-limit" && i + 1 < argc) {
             timeLimit = std::stod(argv[i + 1]);
             i++; // Skip next arg
+        } else if (arg == "--headless") {
+            // No window/GPU; ticks as fast as possible on a simulated clock
+            headless = true;
+        } else if (arg == "--realtime") {
+            // Headless, but paced by the wall clock
+            realtime = true;
+        } else if (arg == "--null-gpu") {
+            // Headless, but RenderSystem runs every frame against the null GPU backend
+            headless = true;
+            nullGpu = true;
+        } else if (arg == "--tick-rate" && i + 1 < argc) {
+            // Fixed simulation rate in Hz; rendering interpolates between ticks
+            tickRate = std::stod(argv[i + 1]);
+            i++;
+        } else if (arg == "--perf-log" && i + 1 < argc) {
+            // Per-frame telemetry CSV plus a percentile summary (.json) written on exit
+            perfLogPath = argv[i + 1];
+            i++;
+        } else if (arg == "--benchmark" && i + 1 < argc) {
+            // Scenario file: scripted camera, fixed step, no vsync; exits when done and writes a report
+            benchmarkPath = argv[i + 1];
+            i++;
+        } else if (arg == "--benchmark-out" && i + 1 < argc) {
+            // Report path, benchmark_<scenario>.json by default
+            benchmarkOutPath = argv[i + 1];
+            i++;
+        } else if (arg == "--stress" && i + 1 < argc) {
+            // Stress settings file: generated load added to the game's scene (overrides a scenario's spawn)
+            stressPath = argv[i + 1];
+            i++;
+        } else if (arg == "--stress-out" && i + 1 < argc) {
+            // Also write the stress scene's static meshes as an .oakscene for the AssetCooker
+            stressOutPath = argv[i + 1];
+            i++;
+        } else if (arg == "--pipelined") {
+            // Simulate the next frame while the current one is recorded and submitted
+            pipelined = true;
         } else if (arg[0] != '-') {
             // Allow overriding via command line
             gameDllPath = arg;
@@ -79,11 +128,41 @@ int main(int argc, char* argv[]) {
     if (timeLimit > 0.0) {
         engine.SetTimeLimit(timeLimit);
     }
+    if (!perfLogPath.empty()) {
+        engine.SetPerfLogPath(perfLogPath);
+    }
+    if (!benchmarkPath.empty() && !engine.SetBenchmark(benchmarkPath, benchmarkOutPath)) {
+        std::cerr << "Failed to load benchmark scenario: " << benchmarkPath << std::endl;
+        return -1;
+    }
+    if (!stressPath.empty()) {
+        Core::StressSceneSettings stress;
+        if (!Core::StressSceneSettings::Load(stressPath, stress)) {
+            std::cerr << "Failed to load stress settings: " << stressPath << std::endl;
+            return -1;
+        }
+        if (!stressOutPath.empty()) {
+            Core::StressSceneGenerator(stress).WriteScene(stressOutPath);
+        }
+        engine.SetStressScene(stress);
+    }
+    if (headless) {
+        engine.SetHeadless(true);
+        engine.SetSimulatedClock(!realtime);
+        engine.SetNullRenderer(nullGpu);
+    }
     
     if (!engine.Init()) {
         std::cerr << "Engine Init Failed" << std::endl;
         return -1;
     }
+    if (pipelined) {
+        // After Init so engine.json can't switch it back off
+        engine.SetPipelinedRendering(true);
+    }
+    if (tickRate > 0.0) {
+        engine.SetFixedTickRate(tickRate);
+    }
 
     GameModule gameModule;
     
@@ -123,5 +202,6 @@ int main(int argc, char* argv[]) {
     }
 
     engine.Shutdown();
+    Core::Log::Shutdown();
     return 0;
 }
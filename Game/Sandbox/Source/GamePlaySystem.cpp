@@ -13,9 +13,15 @@ using namespace Platform;
 GamePlaySystem::GamePlaySystem(Core::GameContext& context) 
     : m_Context(context) {}
 
+GamePlaySystem::~GamePlaySystem() {
+    if (m_Context.Events) {
+        m_Context.Events->Unsubscribe(m_ActionSubscription);
+    }
+}
+
 void GamePlaySystem::Init() {
     if (m_Context.Events) {
-        m_Context.Events->Subscribe<ActionEvent>([this](const ActionEvent& event) {
+        m_ActionSubscription = m_Context.Events->Subscribe<ActionEvent>([this](const ActionEvent& event) {
             this->OnAction(event);
         });
     }
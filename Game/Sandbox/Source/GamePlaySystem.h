@@ -1,15 +1,18 @@
 #pragma once
 
 #include "Core/Context.h"
+#include "Core/EventBus.h"
 
 namespace Platform { struct ActionEvent; }
 
 class GamePlaySystem {
 public:
     GamePlaySystem(Core::GameContext& context);
+    ~GamePlaySystem();
     void Init();
 
 private:
     Core::GameContext& m_Context;
+    Core::EventSubscription m_ActionSubscription; // Dropped on unload, the callback lives in this module
     void OnAction(const Platform::ActionEvent& event);
 };
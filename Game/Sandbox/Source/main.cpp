@@ -215,7 +215,7 @@ GAME_EXPORT void GameInit(Engine& engine) {
         // Mesh origin is at hip, so we offset it down to align feet with transform position
         // Capsule center height = radius + height/2 = 0.3 + 0.6 = 0.9m
         meshEntity = engine.GetContext().World->entity("TestMesh")
-            .set<LocalTransform>({ {0.0f, 0.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f} })
+            .set<LocalTransform>({ {0.0f, 0.0f, 0.0f} })
             .set<MeshComponent>({g_TestMesh, {1.0f, 1.0f, 1.0f, 1.0f}, {0.0f, -0.9f, 0.0f}})  // Offset mesh down to align feet (hip is at center of capsule at 0.9m)
             .set<CharacterController>({ 
                 {0.0f, 0.0f, 0.0f},  // velocity
@@ -290,7 +290,7 @@ GAME_EXPORT void GameInit(Engine& engine) {
     // Create Camera with third-person follow
     if (engine.GetContext().World->count<CameraComponent>() == 0) {
         auto cameraEntity = engine.GetContext().World->entity("MainCamera")
-            .set<LocalTransform>({ {0.0f, 1.0f, 4.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f} })
+            .set<LocalTransform>({ {0.0f, 1.0f, 4.0f} })
             .set<CameraComponent>({ 45.0f, 0.1f, 1000.0f, true });
         
         // Add CameraFollowComponent to orbit around the character
@@ -324,7 +324,7 @@ GAME_EXPORT void GameInit(Engine& engine) {
     g_GroundMesh = CreateGroundPlane(engine.GetResourceManager(), 100.0f, 20);
     if (g_GroundMesh) {
         engine.GetContext().World->entity("Ground")
-            .set<LocalTransform>({ {0.0f, -1.0f, 0.0f}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f} })
+            .set<LocalTransform>({ {0.0f, -1.0f, 0.0f} })
             .set<MeshComponent>({g_GroundMesh})
             .set<Collider>({
                 ColliderType::Box,
@@ -346,7 +346,7 @@ GAME_EXPORT void GameInit(Engine& engine) {
     // Create Sponza environment mesh
     if (g_SponzaMesh) {
         engine.GetContext().World->entity("Sponza")
-            .set<LocalTransform>({ {0.0f, -0.95f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.02f, 0.02f, 0.02f} })  // Scale down from cm to meters
+            .set<LocalTransform>(LocalTransform::FromEuler({0.0f, -0.95f, 0.0f}, {0.0f, 0.0f, 0.0f}, {0.02f, 0.02f, 0.02f}))  // Scale down from cm to meters
             .set<MeshComponent>({g_SponzaMesh});
         LOG_INFO("Created Sponza environment mesh");
     }
@@ -392,11 +392,11 @@ GAME_EXPORT void GameInit(Engine& engine) {
             std::string name = "Obstacle_" + std::to_string(obstacleIdx++);
             float yPos = obs.pos.y + obs.scale.y * 0.5f - 1.0f;
             engine.GetContext().World->entity(name.c_str())
-                .set<LocalTransform>({ 
+                .set<LocalTransform>(LocalTransform::FromEuler(
                     {obs.pos.x, yPos, obs.pos.z},
                     {0.0f, obs.rotY, 0.0f}, 
                     obs.scale 
-                })
+                ))
                 .set<MeshComponent>({g_CubeMesh})
                 .set<Collider>({
                     ColliderType::Box,
@@ -456,7 +456,7 @@ GAME_EXPORT void GameInit(Engine& engine) {
                 
                 std::string name = "PointLight_" + std::to_string(lightIndex++);
                 engine.GetContext().World->entity(name.c_str())
-                    .set<LocalTransform>({ {posX, posY, posZ}, {0.0f, 0.0f, 0.0f}, {1.0f, 1.0f, 1.0f} })
+                    .set<LocalTransform>({ {posX, posY, posZ} })
                     .set<PointLight>({
                         color,
                         2.0f,       // intensity